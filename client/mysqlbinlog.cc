@@ -1343,6 +1343,33 @@ Exit_status process_event(PRINT_EVENT_INFO *print_event_info, Log_event *ev,
         destroy_evt= FALSE;
       break;
     }
+    case TRANSACTION_PAYLOAD_EVENT:
+    {
+      /*
+        Process the events of the payload as if they had been written to
+        the binlog one by one, so that the output can be applied with the
+        mariadb client like any other.
+      */
+      Transaction_payload_reader
+        reader((Transaction_payload_log_event*) ev, glob_description_event);
+      const char *errmsg;
+      Log_event *payload_ev;
+
+      if (ev->print(result_file, print_event_info))
+        goto err;
+      while ((payload_ev= reader.next(&errmsg)))
+      {
+        if ((retval= process_event(print_event_info, payload_ev, pos,
+                                   logname)) != OK_CONTINUE)
+          goto end;
+      }
+      if (errmsg)
+      {
+        error("%s", errmsg);
+        goto err;
+      }
+      break;
+    }
     case START_ENCRYPTION_EVENT:
       glob_description_event->start_decryption((Start_encryption_log_event*)ev);
       /* fall through */
@@ -58,3 +58,102 @@ void radixsort_for_str_ptr(uchar **base, uint number_of_elements, size_t size_of
   next:;
   }
 }
+
+
+/*
+  MSD (most significant digit first) radixsort for pointers to fixed
+  length strings.
+
+  Unlike radixsort_for_str_ptr() which always makes one pass over all
+  elements for every byte of the key, this only looks at as many leading
+  bytes as are needed to tell the keys apart: the elements are distributed
+  into 256 buckets by the byte at 'depth' and every bucket is then sorted
+  recursively on the next byte. Small buckets are finished with an
+  insertion sort. A byte position where all elements of a bucket have the
+  same value is skipped without moving any pointers.
+
+  The recursion depth is bounded by size_of_element, which is why
+  radixsort_msd_is_applicable() limits the key length.
+*/
+
+#define MSD_RADIX_MAX_KEY_LENGTH 32
+#define MSD_RADIX_INSERTION_SORT_LIMIT 32
+
+my_bool radixsort_msd_is_applicable(uint n_items, size_t size_of_element)
+{
+  return size_of_element <= MSD_RADIX_MAX_KEY_LENGTH && n_items >= 1000;
+}
+
+
+static void insertion_sort_for_str_ptr(uchar **base, uint number_of_elements,
+                                       size_t depth, size_t size_of_element)
+{
+  uchar **end= base + number_of_elements, **ptr, **pos;
+  size_t length= size_of_element - depth;
+  for (ptr= base + 1 ; ptr < end ; ptr++)
+  {
+    uchar *key= *ptr;
+    for (pos= ptr ;
+         pos > base && memcmp(pos[-1] + depth, key + depth, length) > 0 ;
+         pos--)
+      *pos= pos[-1];
+    *pos= key;
+  }
+}
+
+
+static void msd_radixsort_for_str_ptr(uchar **base, uint number_of_elements,
+                                      size_t depth, size_t size_of_element,
+                                      uchar **buffer)
+{
+  uchar **end= base + number_of_elements, **ptr;
+  uint32 count[256];
+  uint32 start, i;
+
+  for (;; depth++)
+  {
+    if (depth >= size_of_element)
+      return;
+    if (number_of_elements <= MSD_RADIX_INSERTION_SORT_LIMIT)
+    {
+      insertion_sort_for_str_ptr(base, number_of_elements, depth,
+                                 size_of_element);
+      return;
+    }
+    bzero((uchar*) count, sizeof(count));
+    for (ptr= base ; ptr < end ; ptr++)
+      count[ptr[0][depth]]++;
+    if (count[base[0][depth]] != number_of_elements)
+      break;
+    /* All elements have the same byte at this position */
+  }
+
+  /* Convert the counts to the start positions of the buckets */
+  for (start= 0, i= 0 ; i < 256 ; i++)
+  {
+    uint32 tmp= count[i];
+    count[i]= start;
+    start+= tmp;
+  }
+  for (ptr= base ; ptr < end ; ptr++)
+    buffer[count[ptr[0][depth]]++]= *ptr;
+  memcpy(base, buffer, number_of_elements * sizeof(uchar*));
+
+  /* count[i] is now the end position of bucket i */
+  for (start= 0, i= 0 ; i < 256 ; i++)
+  {
+    if (count[i] - start > 1)
+      msd_radixsort_for_str_ptr(base + start, count[i] - start, depth + 1,
+                                size_of_element, buffer);
+    start= count[i];
+  }
+}
+
+
+void radixsort_msd_for_str_ptr(uchar **base, uint number_of_elements,
+                               size_t size_of_element, uchar **buffer)
+{
+  DBUG_ASSERT(size_of_element <= MSD_RADIX_MAX_KEY_LENGTH);
+  msd_radixsort_for_str_ptr(base, number_of_elements, 0, size_of_element,
+                            buffer);
+}
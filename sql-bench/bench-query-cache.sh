@@ -0,0 +1,101 @@
+#!/usr/bin/env perl
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Library General Public
+# License as published by the Free Software Foundation; version 2
+# of the License.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Library General Public License for more details.
+#
+# You should have received a copy of the GNU Library General Public
+# License along with this library; if not, write to the Free
+# Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+# MA 02110-1335  USA
+#
+# Throughput of query cache hits with a growing number of concurrent
+# clients. Every client runs the same few SELECT statements, which
+# after the first round are all answered from the query cache.
+# The server must be started with query_cache_type=ON and a non-zero
+# query_cache_size.
+#
+##################### Standard benchmark inits ##############################
+
+use Cwd;
+use DBI;
+use Benchmark;
+use Time::HiRes qw(time);
+
+$opt_loop_count=20000;
+$opt_queries=10;
+@clients=(1,2,4,8,16,32,64);
+
+$pwd = cwd(); $pwd = "." if ($pwd eq '');
+require "$pwd/bench-init.pl" || die "Can't read Configuration file: $!\n";
+
+if ($opt_small_test)
+{
+  $opt_loop_count/=10;
+  @clients=(1,2,4,8);
+}
+
+print "Testing the throughput of query cache hits\n";
+print "Every client runs $opt_loop_count queries.\n\n";
+
+####
+####  Connect and start timeing
+####
+
+$dbh = $server->connect();
+$start_time=new Benchmark;
+
+$dbh->do("drop table bench1" . $server->{'drop_attr'});
+do_many($dbh,$server->create("bench1",
+			     ["id integer(6) NOT NULL",
+			      "val char(32) NOT NULL"],
+			     ["primary key (id)"]));
+for ($i=0 ; $i < $opt_queries ; $i++)
+{
+  do_query($dbh,"insert into bench1 values ($i,'value $i')");
+}
+
+foreach $n (@clients)
+{
+  $hits=query_cache_hits($dbh);
+  $begin=time();
+  for ($c=0 ; $c < $n ; $c++)
+  {
+    if (!fork())
+    {
+      # Do not close the connection of the parent on exit
+      $dbh->{InactiveDestroy}=1;
+      my $cdbh=$server->connect();
+      for (my $i=0 ; $i < $opt_loop_count ; $i++)
+      {
+	fetch_all_rows($cdbh,"select val from bench1 where id=" .
+		       ($i % $opt_queries),1);
+      }
+      $cdbh->disconnect;
+      exit(0);
+    }
+  }
+  while (wait() != -1) {}
+  $elapsed=time()-$begin;
+  $hits=query_cache_hits($dbh)-$hits;
+  printf("%3d clients: %9.0f queries/s, %d query cache hits\n", $n,
+	 $n * $opt_loop_count / $elapsed, $hits);
+}
+
+$dbh->do("drop table bench1" . $server->{'drop_attr'});
+$dbh->disconnect;
+
+end_benchmark($start_time);
+
+
+sub query_cache_hits
+{
+  my ($dbh)=@_;
+  my ($row)=$dbh->selectrow_arrayref("show global status like 'Qcache_hits'");
+  return defined($row) ? $row->[1] : 0;
+}
@@ -273,6 +273,7 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
 
   param.set_all_read_bits= filesort->set_all_read_bits;
   param.unpack= filesort->unpack;
+  param.max_sort_threads= (uint) thd->variables.max_sort_threads;
 
   sort->addon_fields=  param.addon_fields;
   sort->sort_keys= param.sort_keys;
@@ -20,6 +20,15 @@
 #include "sql_sort.h"
 #include "table.h"
 #include "optimizer_defaults.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/*
+  Minimum number of sort keys each thread should get when a sort buffer
+  is sorted by several threads, see Filesort_buffer::sort_buffer()
+*/
+#define MIN_KEYS_PER_SORT_THREAD 16384
 
 PSI_memory_key key_memory_Filesort_buffer_sort_keys;
 
@@ -383,6 +392,203 @@ void Filesort_buffer::free_sort_buffer()
 }
 
 
+/*
+  Merge the sorted arrays from[0..mid) and from[mid..end) into to[0..end)
+*/
+
+static void merge_sorted_keys(uchar **from, size_t mid, size_t end,
+                              uchar **to, qsort2_cmp cmp, void *cmp_arg)
+{
+  size_t i= 0, j= mid, k= 0;
+  while (i < mid && j < end)
+    to[k++]= cmp(cmp_arg, &from[j], &from[i]) < 0 ? from[j++] : from[i++];
+  while (i < mid)
+    to[k++]= from[i++];
+  while (j < end)
+    to[k++]= from[j++];
+}
+
+
+/*
+  How a range of sort keys is sorted: with a MSD radixsort on the key
+  bytes when the keys are short, of fixed length and memcmp() comparable,
+  otherwise with my_qsort2() and the compare function of the sort.
+*/
+
+struct Sort_keys_method
+{
+  bool radix;
+  size_t sort_length;
+  qsort2_cmp cmp;
+  void *cmp_arg;
+
+  /* buffer is a scratch array of count elements */
+  void sort(uchar **keys, size_t count, uchar **buffer) const
+  {
+    if (radix)
+      radixsort_msd_for_str_ptr(keys, (uint) count, sort_length, buffer);
+    else
+      my_qsort2(keys, count, sizeof(uchar*), cmp, cmp_arg);
+  }
+};
+
+
+/*
+  Number of helper threads currently started by parallel_sort_keys() in
+  all sessions together. It is kept at or below the number of CPUs, so
+  that concurrent sorts do not start max_sort_threads threads each.
+*/
+static std::atomic<uint> sort_helper_threads(0);
+
+
+/*
+  Reserve up to 'wanted' helper threads from the server wide limit
+
+  @return number of helper threads reserved, may be 0
+*/
+
+static uint reserve_sort_helper_threads(uint wanted)
+{
+  const uint limit= (uint) MY_MAX(my_getncpus(), 1);
+  uint used= sort_helper_threads.load(std::memory_order_relaxed);
+  uint got;
+  do
+  {
+    if (used >= limit)
+      return 0;
+    got= MY_MIN(wanted, limit - used);
+  } while (!sort_helper_threads.compare_exchange_weak(used, used + got,
+                                                      std::memory_order_relaxed));
+  return got;
+}
+
+
+/*
+  Run a task in a new helper thread, or in the calling thread if a
+  thread can not be started
+
+  workers must have room for the new thread so that emplace_back() does
+  not allocate.
+*/
+
+template <typename F>
+static void start_sort_helper(std::vector<std::thread> &workers, F task)
+{
+  DBUG_ASSERT(workers.size() < workers.capacity());
+  try
+  {
+    workers.emplace_back([task]
+                         {
+                           my_thread_init();
+                           task();
+                           my_thread_end();
+                         });
+  }
+  catch (...)
+  {
+    task();
+  }
+}
+
+
+/*
+  Sort an array of sort keys using several threads
+
+  @param keys       Array of pointers to sort keys
+  @param count      Number of elements in keys
+  @param threads    Number of threads to use, > 1
+  @param buffer     Scratch array of count elements
+  @param method     How to sort each chunk and compare keys
+
+  The array is divided into 'threads' chunks that are sorted in parallel.
+  The sorted chunks are then merged pairwise, each pass halving the number
+  of chunks and running its merges in parallel.
+  The calling thread always processes one of the chunks itself.
+  If a helper thread can not be started, its work is done by the calling
+  thread.
+
+  @return
+    the array holding the sorted result, either keys or buffer
+  @retval NULL  No helper threads were available, nothing was sorted
+*/
+
+static uchar **parallel_sort_keys(uchar **keys, size_t count, uint threads,
+                                  uchar **buffer,
+                                  const Sort_keys_method &method)
+{
+  std::vector<size_t> bounds, merged;
+  std::vector<std::thread> workers;
+
+  if (!(threads= reserve_sort_helper_threads(threads - 1)))
+    return NULL;
+  threads++;
+
+  /* Allocate everything up front, nothing below may throw */
+  try
+  {
+    bounds.reserve(threads + 1);
+    merged.reserve(threads + 1);
+    workers.reserve(threads);
+  }
+  catch (const std::bad_alloc &)
+  {
+    sort_helper_threads.fetch_sub(threads - 1, std::memory_order_relaxed);
+    return NULL;
+  }
+
+  for (uint i= 0; i <= threads; i++)
+    bounds.push_back(count * i / threads);
+
+  for (uint i= 1; i < threads; i++)
+  {
+    uchar **start= keys + bounds[i], **scratch= buffer + bounds[i];
+    size_t elements= bounds[i + 1] - bounds[i];
+    start_sort_helper(workers, [=, &method]
+                      { method.sort(start, elements, scratch); });
+  }
+  method.sort(keys, bounds[1], buffer);
+  for (std::thread &worker : workers)
+    worker.join();
+
+  uchar **from= keys, **to= buffer;
+  while (bounds.size() > 2)
+  {
+    merged.clear();
+    workers.clear();
+    for (size_t i= 0; i + 1 < bounds.size(); i+= 2)
+    {
+      size_t start= bounds[i];
+      merged.push_back(start);
+      if (i + 2 == bounds.size())
+      {
+        /* Odd chunk out, just move it to the destination */
+        memcpy(to + start, from + start,
+               (bounds[i + 1] - start) * sizeof(uchar*));
+        continue;
+      }
+      size_t mid= bounds[i + 1] - start, end= bounds[i + 2] - start;
+      if (start == 0)
+        continue;                               // Done by this thread below
+      uchar **src= from + start, **dst= to + start;
+      start_sort_helper(workers, [=, &method]
+                        {
+                          merge_sorted_keys(src, mid, end, dst, method.cmp,
+                                            method.cmp_arg);
+                        });
+    }
+    merge_sorted_keys(from, bounds[1], bounds[2], to, method.cmp,
+                      method.cmp_arg);
+    for (std::thread &worker : workers)
+      worker.join();
+    merged.push_back(count);
+    bounds.swap(merged);
+    std::swap(from, to);
+  }
+  sort_helper_threads.fetch_sub(threads - 1, std::memory_order_relaxed);
+  return from;
+}
+
+
 void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
 {
   size_t size= param->sort_length;
@@ -395,20 +601,36 @@ void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
   if (!param->using_pq)
     reverse_record_pointers();
 
+  Sort_keys_method method;
+  method.radix= (!param->using_packed_sortkeys() &&
+                 radixsort_msd_is_applicable(count, size));
+  method.sort_length= size;
+  method.cmp= param->get_compare_function();
+  method.cmp_arg= param->get_compare_argument(&size);
+
   uchar **buffer= NULL;
-  if (!param->using_packed_sortkeys() &&
-      radixsort_is_applicable(count, param->sort_length) &&
+  uint threads= MY_MIN(param->max_sort_threads,
+                       count / MIN_KEYS_PER_SORT_THREAD);
+  if ((threads > 1 || method.radix) &&
       (buffer= (uchar**) my_malloc(PSI_INSTRUMENT_ME, count*sizeof(char*),
                                    MYF(MY_THREAD_SPECIFIC))))
   {
-    radixsort_for_str_ptr(m_sort_keys, count, param->sort_length, buffer);
+    if (threads > 1)
+    {
+      uchar **sorted= parallel_sort_keys(m_sort_keys, count, threads, buffer,
+                                         method);
+      if (!sorted)
+        method.sort(m_sort_keys, count, buffer);
+      else if (sorted != m_sort_keys)
+        memcpy(m_sort_keys, sorted, count * sizeof(uchar*));
+    }
+    else
+      method.sort(m_sort_keys, count, buffer);
     my_free(buffer);
     return;
   }
 
-  my_qsort2(m_sort_keys, count, sizeof(uchar*),
-            param->get_compare_function(),
-            param->get_compare_argument(&size));
+  my_qsort2(m_sort_keys, count, sizeof(uchar*), method.cmp, method.cmp_arg);
 }
 
 
@@ -43,6 +43,7 @@
 
 #include <my_dir.h>
 #include <m_ctype.h>				// For test_if_number
+#include "zlib.h"
 
 #include <set_var.h> // for Sys_last_gtid_ptr
 
@@ -69,6 +70,7 @@
 #include "semisync_master.h"
 #include "semisync_slave.h"
 #include <utility>     // pair
+#include <unordered_set>
 #endif
 
 /* max size of the log message */
@@ -114,6 +116,7 @@ ulong opt_binlog_dbug_fsync_sleep= 0;
 
 mysql_mutex_t LOCK_prepare_ordered;
 mysql_cond_t COND_prepare_ordered;
+mysql_mutex_t LOCK_binlog_sync;
 mysql_mutex_t LOCK_after_binlog_sync;
 mysql_mutex_t LOCK_commit_ordered;
 
@@ -516,7 +519,8 @@ class binlog_cache_mngr {
                     ulong *param_ptr_binlog_stmt_cache_disk_use,
                     ulong *param_ptr_binlog_cache_use,
                     ulong *param_ptr_binlog_cache_disk_use)
-    : last_commit_pos_offset(0), using_xa(FALSE), xa_xid(0)
+    : last_commit_pos_offset(0), using_xa(FALSE), xa_xid(0),
+      writeset(PSI_INSTRUMENT_MEM, 16, 64), writeset_unknown(false)
   {
      stmt_cache.set_binlog_cache_info(param_max_binlog_stmt_cache_size,
                                       param_ptr_binlog_stmt_cache_use,
@@ -537,6 +541,9 @@ class binlog_cache_mngr {
       using_xa= FALSE;
       last_commit_pos_file[0]= 0;
       last_commit_pos_offset= 0;
+      writeset.clear();
+      writeset_unknown= false;
+      trx_payload.free();
     }
   }
 
@@ -581,6 +588,19 @@ class binlog_cache_mngr {
   //Will be reset when gtid is written into binlog
   uchar  gtid_flags3;
   decltype (rpl_gtid::seq_no) sa_seq_no;
+  /*
+    Hashes of the unique key values that the transaction modified, for
+    binlog_transaction_dependency_tracking=WRITESET. If writeset_unknown
+    is set, the transaction may conflict with any other transaction.
+  */
+  Dynamic_array<uint32> writeset;
+  bool writeset_unknown;
+  /*
+    With binlog_transaction_compression=ON, the body of the
+    Transaction_payload_log_event that replaces the content of trx_cache
+    in the binlog. Empty if the transaction is written uncompressed.
+  */
+  String trx_payload;
 private:
 
   binlog_cache_mngr& operator=(const binlog_cache_mngr& info);
@@ -3564,6 +3584,8 @@ MYSQL_BIN_LOG::MYSQL_BIN_LOG(uint *sync_period)
    group_commit_trigger_count(0), group_commit_trigger_timeout(0),
    group_commit_trigger_lock_wait(0),
    sync_period_ptr(sync_period), sync_counter(0),
+   binlog_synced_id(0), binlog_synced_pos(0), binlog_flushed_pos(0),
+   group_commit_syncing(false),
    state_file_deleted(false), binlog_state_recover_done(false),
    is_relay_log(0), relay_signal_cnt(0),
    checksum_alg_reset(BINLOG_CHECKSUM_ALG_UNDEF),
@@ -4490,8 +4512,8 @@ bool MYSQL_BIN_LOG::reset_logs(THD *thd, bool create_new_log,
       Without binlog, we cannot XA recover prepared-but-not-committed
       transactions in engines. So force a commit checkpoint first.
 
-      Note that we take and immediately
-      release LOCK_after_binlog_sync/LOCK_commit_ordered. This has
+      Note that we take and immediately release LOCK_binlog_sync/
+      LOCK_after_binlog_sync/LOCK_commit_ordered. This has
       the effect to ensure that any on-going group commit (in
       trx_group_commit_leader()) has completed before we request the checkpoint,
       due to the chaining of LOCK_log and LOCK_commit_ordered in that function.
@@ -4503,7 +4525,9 @@ bool MYSQL_BIN_LOG::reset_logs(THD *thd, bool create_new_log,
       later would leave such transaction not recoverable.
     */
 
+    mysql_mutex_lock(&LOCK_binlog_sync);
     mysql_mutex_lock(&LOCK_after_binlog_sync);
+    mysql_mutex_unlock(&LOCK_binlog_sync);
     mysql_mutex_lock(&LOCK_commit_ordered);
     mysql_mutex_unlock(&LOCK_after_binlog_sync);
     mysql_mutex_unlock(&LOCK_commit_ordered);
@@ -5474,6 +5498,9 @@ int MYSQL_BIN_LOG::new_file_impl()
     DBUG_RETURN(error);
   }
 
+  /* The file must not be closed while a group commit syncs it */
+  if (!is_relay_log)
+    wait_for_binlog_sync();
   mysql_mutex_lock(&LOCK_index);
 
   /* Reuse old name if not binlog and not update log */
@@ -5978,6 +6005,168 @@ void THD::set_binlog_start_alter_seq_no(uint64 s_no)
 }
 
 
+/*
+  Add the hashes of the unique keys of a row that is being logged to the
+  writeset of the transaction.
+
+  @param table     the table of the row
+  @param is_trans  whether the row is logged in the transactional cache
+  @param record    the row image
+  @param cols      the columns that are valid in record, or NULL for all
+
+  If any change of the row could conflict with another transaction in a
+  way that is not visible in its unique keys, the writeset of the
+  transaction becomes unknown.
+*/
+void THD::binlog_writeset_add_row(TABLE *table, bool is_trans,
+                                  const uchar *record, const MY_BITMAP *cols)
+{
+  binlog_cache_mngr *const cache_mngr= binlog_setup_trx_data();
+  if (!cache_mngr || cache_mngr->writeset_unknown)
+    return;
+
+  /*
+    Rows of non-transactional tables can not be rolled back, and the
+    effects of FOREIGN KEY constraints are not visible in the row.
+  */
+  if (opt_binlog_transaction_dependency_tracking != BINLOG_DEPENDENCY_WRITESET ||
+      !is_trans || !table->file->can_switch_engines() ||
+      transaction->xid_state.is_explicit_XA() ||
+      cache_mngr->writeset.elements() >=
+      opt_binlog_transaction_dependency_history_size)
+  {
+    cache_mngr->writeset_unknown= true;
+    return;
+  }
+
+  const my_ptrdiff_t diff= record - table->record[0];
+  bool found= false, unknown= false;
+  /*
+    With binlog_row_image=MINIMAL only the primary key is marked for read,
+    but record holds all columns given by cols.
+  */
+  MY_BITMAP *old_map= dbug_tmp_use_all_columns(table, &table->read_set);
+
+  for (uint i= 0; i < table->s->keys && !unknown; i++)
+  {
+    const KEY *key= &table->key_info[i];
+    if (!(key->flags & HA_NOSAME))
+      continue;
+
+    Hasher hasher;
+    hasher.add(&my_charset_bin, table->s->table_cache_key.str,
+               table->s->table_cache_key.length);
+    hasher.add(&my_charset_bin, key->name.str, key->name.length);
+
+    bool has_null= false;
+    for (uint j= 0; j < key->user_defined_key_parts; j++)
+    {
+      const KEY_PART_INFO *key_part= &key->key_part[j];
+      Field *field= key_part->field;
+      /* A prefix or a hash can not tell apart the values that conflict */
+      if ((key_part->key_part_flag & HA_PART_KEY_SEG) ||
+          key->algorithm == HA_KEY_ALG_LONG_HASH ||
+          (cols && !bitmap_is_set(cols, field->field_index)))
+      {
+        unknown= true;
+        break;
+      }
+      if (field->is_null_in_record(record))
+      {
+        has_null= true;
+        break;
+      }
+      field->move_field_offset(diff);
+      field->hash_not_null(&hasher);
+      field->move_field_offset(-diff);
+    }
+
+    if (has_null || unknown)
+      continue;
+    if (cache_mngr->writeset.append(hasher.finalize()))
+      unknown= true;
+    else
+      found= true;
+  }
+  dbug_tmp_restore_column_map(&table->read_set, old_map);
+
+  /* A row that is not identified by a unique key may conflict with any */
+  if (unknown || !found)
+    cache_mngr->writeset_unknown= true;
+}
+
+
+/*
+  State of binlog_transaction_dependency_tracking=WRITESET, protected by
+  LOCK_log; see writeset_commit_id().
+*/
+static struct binlog_writeset_history
+{
+  /* Key hashes of all transactions of the current group */
+  std::unordered_set<uint32> hashes;
+  /* commit_id of the current group, or 0 if there is no group */
+  uint64 commit_id;
+  /* The commit_id that was last written, in either mode */
+  uint64 last_commit_id;
+  /* Whether all transactions of the group are from one binlog group commit */
+  bool single_batch;
+  /* Whether the writesets of all transactions of the group are known */
+  bool known;
+} writeset_history;
+
+
+/*
+  Determine the commit_id of a transaction for
+  binlog_transaction_dependency_tracking=WRITESET.
+
+  @param cache_mngr  the transaction
+  @param same_batch  whether the transaction is in the same binlog group
+                     commit as the previous one
+
+  A slave in slave_parallel_mode=conservative runs consecutive event
+  groups with the same commit_id in parallel. A transaction may join the
+  group of the previous transaction if it was group-committed together
+  with all transactions of that group (as with COMMIT_ORDER), or if its
+  key hashes and those of the whole group are known and disjoint.
+
+  @return the commit_id to write in the GTID event
+*/
+static uint64 writeset_commit_id(binlog_cache_mngr *cache_mngr,
+                                 bool same_batch)
+{
+  binlog_writeset_history &h= writeset_history;
+  const bool known= !cache_mngr->writeset_unknown &&
+    cache_mngr->writeset.elements() && cache_mngr->stmt_cache.empty();
+
+  bool join= h.commit_id && h.commit_id == h.last_commit_id;
+  if (join && !(same_batch && h.single_batch))
+  {
+    join= known && h.known &&
+      h.hashes.size() + cache_mngr->writeset.elements() <=
+      opt_binlog_transaction_dependency_history_size;
+    for (size_t i= 0; join && i < cache_mngr->writeset.elements(); i++)
+      join= !h.hashes.count(cache_mngr->writeset.at(i));
+    h.single_batch= h.single_batch && same_batch;
+  }
+
+  if (!join)
+  {
+    h.hashes.clear();
+    h.commit_id= h.last_commit_id + 1;
+    h.single_batch= true;
+    h.known= true;
+  }
+
+  if (known && h.known)
+    for (size_t i= 0; i < cache_mngr->writeset.elements(); i++)
+      h.hashes.insert(cache_mngr->writeset.at(i));
+  else
+    h.known= false;
+
+  return h.commit_id;
+}
+
+
 /*
   Function to start a statement and optionally a transaction for the
   binary log.
@@ -6855,6 +7044,7 @@ bool MYSQL_BIN_LOG::write(Log_event *event_info, my_bool *with_annotate)
           commit_id= entry->val_int(&null_value);
         });
       res= write_gtid_event(thd, true, using_trans, commit_id);
+      writeset_history.last_commit_id= commit_id;
       if (mdl_request.ticket)
         thd->mdl_context.release_lock(mdl_request.ticket);
       thd->backup_commit_lock= 0;
@@ -6870,6 +7060,9 @@ bool MYSQL_BIN_LOG::write(Log_event *event_info, my_bool *with_annotate)
       is_trans_cache= use_trans_cache(thd, using_trans);
       cache_data= cache_mngr->get_binlog_cache_data(is_trans_cache);
       file= &cache_data->cache_log;
+      /* The effects of a statement are not visible in key hashes */
+      if (event_info->get_type_code() != TABLE_MAP_EVENT)
+        cache_mngr->writeset_unknown= true;
 
       if (thd->lex->stmt_accessed_non_trans_temp_table() && is_trans_cache)
         thd->transaction->stmt.mark_modified_non_trans_temp_table();
@@ -7007,6 +7200,7 @@ bool MYSQL_BIN_LOG::write(Log_event *event_info, my_bool *with_annotate)
       status_var_add(thd->status_var.binlog_bytes_written,
                      offset - my_org_b_tell);
 
+      wait_for_binlog_sync();
       mysql_mutex_lock(&LOCK_after_binlog_sync);
       mysql_mutex_unlock(&LOCK_log);
 
@@ -7446,6 +7640,7 @@ int MYSQL_BIN_LOG::rotate_and_purge(bool force_rotate,
           checkpoint notification request until early binlogged
           concurrent commits have has been completed.
   */
+  wait_for_binlog_sync();
   mysql_mutex_lock(&LOCK_after_binlog_sync);
   mysql_mutex_unlock(&LOCK_log);
   mysql_mutex_lock(&LOCK_commit_ordered);
@@ -7831,6 +8026,78 @@ write_binlog_checkpoint_event_already_locked(const char *name_arg, uint len)
 }
 
 
+/**
+  Compress the transaction cache into the body of a
+  Transaction_payload_log_event, stored in cache_mngr->trx_payload.
+
+  This is done by the committing thread before it queues up for group
+  commit, so the compression does not extend the time LOCK_log is held.
+  The output buffer is no bigger than the cache, so a transaction that
+  does not compress is detected early and written as it is.
+  Only a cache that fits into its binlog_cache_size buffer is compressed.
+  A transaction that was spilled to a temporary file is written
+  uncompressed, so that the output buffer stays small.
+
+  @return false if the payload is ready, true if the transaction is to be
+          written uncompressed
+*/
+
+static bool binlog_compress_trx_cache(binlog_cache_mngr *cache_mngr)
+{
+  IO_CACHE *cache= cache_mngr->get_binlog_cache_log(TRUE);
+  String *payload= &cache_mngr->trx_payload;
+  my_off_t cache_size= my_b_write_tell(cache);
+  const uint header_len= Transaction_payload_log_event::BODY_HEADER_LEN;
+  z_stream strm;
+  size_t length;
+  uchar *buf;
+  int res= Z_OK;
+
+  DBUG_ENTER("binlog_compress_trx_cache");
+  if (cache_size <= header_len || cache_size > cache->buffer_length ||
+      cache_size > MAX_MAX_ALLOWED_PACKET ||
+      payload->alloc((size_t) cache_size) ||
+      reinit_io_cache(cache, READ_CACHE, 0, 0, 0))
+    DBUG_RETURN(true);
+
+  bzero(&strm, sizeof(strm));
+  if (deflateInit(&strm, Z_DEFAULT_COMPRESSION) != Z_OK)
+    DBUG_RETURN(true);
+
+  buf= (uchar*) payload->ptr();
+  buf[0]= Transaction_payload_log_event::TRANSACTION_PAYLOAD_ZLIB;
+  int8store(buf + 1, cache_size);
+  strm.next_out= buf + header_len;
+  strm.avail_out= (uInt) (cache_size - header_len);
+
+  for (length= my_b_bytes_in_cache(cache); length; length= my_b_fill(cache))
+  {
+    strm.next_in= (Bytef*) cache->read_pos;
+    strm.avail_in= (uInt) length;
+    while (strm.avail_in && strm.avail_out && res == Z_OK)
+      res= deflate(&strm, Z_NO_FLUSH);
+    if (strm.avail_in)
+      break;                              /* Does not compress, or error */
+  }
+  if (!strm.avail_in && !cache->error)
+  {
+    while (res == Z_OK && strm.avail_out)
+      res= deflate(&strm, Z_FINISH);
+  }
+  deflateEnd(&strm);
+
+  if (res != Z_STREAM_END)
+  {
+    payload->free();
+    DBUG_RETURN(true);
+  }
+  payload->length((uint32) (header_len + strm.total_out));
+  DBUG_PRINT("info", ("compressed %llu bytes to %u", (ulonglong) cache_size,
+                      payload->length()));
+  DBUG_RETURN(false);
+}
+
+
 /**
   Write a cached log entry to the binary log.
   - To support transaction over replication, we wrap the transaction
@@ -7901,6 +8168,13 @@ MYSQL_BIN_LOG::write_transaction_to_binlog(THD *thd,
       entry.need_unlog= true;
   }
 
+  if (opt_binlog_transaction_compression && using_trx_cache &&
+      !cache_mngr->trx_cache.empty() &&
+      !cache_mngr->stmt_cache.has_incident() &&
+      !cache_mngr->trx_cache.has_incident() &&
+      !thd->transaction->xid_state.is_explicit_XA())
+    binlog_compress_trx_cache(cache_mngr);
+
   if (cache_mngr->stmt_cache.has_incident() ||
       cache_mngr->trx_cache.has_incident())
   {
@@ -8417,6 +8691,97 @@ MYSQL_BIN_LOG::write_transaction_to_binlog_events(group_commit_entry *entry)
   return 1;
 }
 
+/*
+  The sync stage of binlog group commit: fsync() the binlog as required by
+  sync_binlog, and publish the transactions of the group to dump threads.
+
+  This runs either holding LOCK_binlog_sync, with LOCK_log released so that
+  the next group commit can write to the binlog meanwhile, or holding
+  LOCK_log after wait_for_binlog_sync(). As one fsync() makes everything
+  that was written to the file before it durable, a group commit whose
+  transactions were already synced by the previous group skips its own.
+*/
+void
+MYSQL_BIN_LOG::sync_group_commit(group_commit_entry *queue, ulong binlog_id,
+                                 my_off_t commit_offset, bool need_sync,
+                                 bool error)
+{
+  group_commit_entry *current;
+  DBUG_ENTER("MYSQL_BIN_LOG::sync_group_commit");
+
+  if (likely(!error) && need_sync &&
+      (binlog_synced_id != binlog_id || binlog_synced_pos < commit_offset))
+  {
+    my_off_t pos= binlog_flushed_pos;
+    DBUG_ASSERT(pos >= commit_offset);
+    group_commit_syncing= true;
+    error= mysql_file_sync(log_file.file, MYF(MY_WME|MY_SYNC_FILESIZE));
+#ifndef DBUG_OFF
+    if (opt_binlog_dbug_fsync_sleep > 0)
+      my_sleep(opt_binlog_dbug_fsync_sleep);
+#endif
+    group_commit_syncing= false;
+    if (likely(!error))
+    {
+      binlog_synced_id= binlog_id;
+      binlog_synced_pos= pos;
+    }
+  }
+
+  if (unlikely(error))
+  {
+    for (current= queue; current != NULL; current= current->next)
+    {
+      if (!current->error)
+      {
+        current->error= ER_ERROR_ON_WRITE;
+        current->commit_errno= errno;
+        current->error_cache= NULL;
+      }
+    }
+    DBUG_VOID_RETURN;
+  }
+
+  DEBUG_SYNC(queue->thd, "commit_before_update_binlog_end_pos");
+  bool any_error= false;
+
+  mysql_mutex_assert_not_owner(&LOCK_prepare_ordered);
+  mysql_mutex_assert_not_owner(&LOCK_after_binlog_sync);
+  mysql_mutex_assert_not_owner(&LOCK_commit_ordered);
+
+  for (current= queue; current != NULL; current= current->next)
+  {
+#ifdef HAVE_REPLICATION
+    if (likely(!current->error) &&
+        unlikely(repl_semisync_master.
+                 report_binlog_update(current->thd,
+                                      current->cache_mngr->
+                                      last_commit_pos_file,
+                                      current->cache_mngr->
+                                      last_commit_pos_offset)))
+    {
+      current->error= ER_ERROR_ON_WRITE;
+      current->commit_errno= -1;
+      current->error_cache= NULL;
+      any_error= true;
+    }
+#endif
+  }
+
+  /*
+    update binlog_end_pos so it can be read by dump thread
+    Note: must be _after_ the RUN_HOOK(after_flush) or else
+    semi-sync might not have put the transaction into
+    it's list before dump-thread tries to send it
+  */
+  set_binlog_end_pos(commit_offset);
+
+  if (unlikely(any_error))
+    sql_print_error("Failed to run 'after_flush' hooks");
+  DBUG_VOID_RETURN;
+}
+
+
 /*
   Do binlog group commit as the lead thread.
 
@@ -8426,6 +8791,12 @@ MYSQL_BIN_LOG::write_transaction_to_binlog_events(group_commit_entry *entry)
   for LOCK_log). After commit is done, all other threads in the queue will be
   signalled.
 
+  The group commit passes through stages that are serialised by LOCK_log
+  (writing to the binlog), LOCK_binlog_sync (fsync() and publishing to dump
+  threads; see sync_group_commit()), LOCK_after_binlog_sync (semi-sync wait)
+  and LOCK_commit_ordered (commit in the engines). Each lock is acquired
+  before the previous one is released, so that the groups keep their order,
+  while consecutive groups can be in different stages at the same time.
  */
 void
 MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
@@ -8435,6 +8806,7 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
   group_commit_entry *current, *last_in_queue;
   group_commit_entry *queue= NULL;
   bool check_purge= false;
+  bool need_sync= false, pipelined= false;
   ulong UNINIT_VAR(binlog_id);
   uint64 commit_id;
   DBUG_ENTER("MYSQL_BIN_LOG::trx_group_commit_leader");
@@ -8522,8 +8894,15 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
                   !cache_mngr->trx_cache.empty()  ||
                   current->thd->transaction->xid_state.is_explicit_XA());
 
+      uint64 trx_commit_id= commit_id;
+      if (opt_binlog_transaction_dependency_tracking ==
+          BINLOG_DEPENDENCY_WRITESET)
+        trx_commit_id= writeset_commit_id(cache_mngr,
+                                          commit_id && current != queue);
+      writeset_history.last_commit_id= trx_commit_id;
+
       if (unlikely((current->error= write_transaction_or_stmt(current,
-                                                              commit_id))))
+                                                              trx_commit_id))))
         current->commit_errno= errno;
 
       strmake_buf(cache_mngr->last_commit_pos_file, log_file_name);
@@ -8551,58 +8930,13 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
     }
     set_current_thd(leader->thd);
 
-    bool synced= 0;
-    if (unlikely(flush_and_sync(&synced)))
+    bool error= flush_io_cache(&log_file);
+    binlog_flushed_pos= my_b_tell(&log_file);
+    uint sync_period= get_sync_period();
+    if (sync_period && ++sync_counter >= sync_period)
     {
-      for (current= queue; current != NULL; current= current->next)
-      {
-        if (!current->error)
-        {
-          current->error= ER_ERROR_ON_WRITE;
-          current->commit_errno= errno;
-          current->error_cache= NULL;
-        }
-      }
-    }
-    else
-    {
-      DEBUG_SYNC(leader->thd, "commit_before_update_binlog_end_pos");
-      bool any_error= false;
-
-      mysql_mutex_assert_not_owner(&LOCK_prepare_ordered);
-      mysql_mutex_assert_owner(&LOCK_log);
-      mysql_mutex_assert_not_owner(&LOCK_after_binlog_sync);
-      mysql_mutex_assert_not_owner(&LOCK_commit_ordered);
-
-      for (current= queue; current != NULL; current= current->next)
-      {
-#ifdef HAVE_REPLICATION
-        if (likely(!current->error) &&
-            unlikely(repl_semisync_master.
-                     report_binlog_update(current->thd,
-                                          current->cache_mngr->
-                                          last_commit_pos_file,
-                                          current->cache_mngr->
-                                          last_commit_pos_offset)))
-        {
-          current->error= ER_ERROR_ON_WRITE;
-          current->commit_errno= -1;
-          current->error_cache= NULL;
-          any_error= true;
-        }
-#endif
-      }
-
-      /*
-        update binlog_end_pos so it can be read by dump thread
-        Note: must be _after_ the RUN_HOOK(after_flush) or else
-        semi-sync might not have put the transaction into
-        it's list before dump-thread tries to send it
-      */
-      update_binlog_end_pos(commit_offset);
-
-      if (unlikely(any_error))
-        sql_print_error("Failed to run 'after_flush' hooks");
+      sync_counter= 0;
+      need_sync= true;
     }
 
     /*
@@ -8616,40 +8950,75 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
       mark_xids_active(binlog_id, xid_count);
     }
 
-    if (rotate(false, &check_purge))
+    /*
+      Unless the binlog is to be rotated, the fsync() and the publishing to
+      dump threads are done in the sync stage below, after releasing
+      LOCK_log, so that the next group commit can write to the binlog
+      meanwhile.
+    */
+    pipelined= likely(!error) && my_b_tell(&log_file) < (my_off_t) max_size;
+    if (!pipelined)
     {
-      /*
-        If we fail to rotate, which thread should get the error?
-        We give the error to the leader, as any my_error() thrown inside
-        rotate() will have been registered for the leader THD.
-
-        However we must not return error from here - that would cause
-        ha_commit_trans() to abort and rollback the transaction, which would
-        leave an inconsistent state with the transaction committed in the
-        binlog but rolled back in the engine.
+      wait_for_binlog_sync();
+      sync_group_commit(queue, binlog_id, commit_offset, need_sync, error);
 
-        Instead set a flag so that we can return error later, from unlog(),
-        when the transaction has been safely committed in the engine.
-      */
-      leader->cache_mngr->delayed_error= true;
-      my_error(ER_ERROR_ON_WRITE, MYF(ME_ERROR_LOG), name, errno);
-      check_purge= false;
+      if (rotate(false, &check_purge))
+      {
+        /*
+          If we fail to rotate, which thread should get the error?
+          We give the error to the leader, as any my_error() thrown inside
+          rotate() will have been registered for the leader THD.
+
+          However we must not return error from here - that would cause
+          ha_commit_trans() to abort and rollback the transaction, which
+          would leave an inconsistent state with the transaction committed
+          in the binlog but rolled back in the engine.
+
+          Instead set a flag so that we can return error later, from
+          unlog(), when the transaction has been safely committed in the
+          engine.
+        */
+        leader->cache_mngr->delayed_error= true;
+        my_error(ER_ERROR_ON_WRITE, MYF(ME_ERROR_LOG), name, errno);
+        check_purge= false;
+      }
+      /* In case of binlog rotate, update the correct current binlog offset. */
+      commit_offset= my_b_write_tell(&log_file);
     }
-    /* In case of binlog rotate, update the correct current binlog offset. */
-    commit_offset= my_b_write_tell(&log_file);
   }
 
   DEBUG_SYNC(leader->thd, "commit_before_get_LOCK_after_binlog_sync");
-  mysql_mutex_lock(&LOCK_after_binlog_sync);
-  /*
-    We cannot unlock LOCK_log until we have locked LOCK_after_binlog_sync;
-    otherwise scheduling could allow the next group commit to run ahead of us,
-    messing up the order of commit_ordered() calls. But as soon as
-    LOCK_after_binlog_sync is obtained, we can let the next group commit start.
-  */
-  mysql_mutex_unlock(&LOCK_log);
+  if (pipelined)
+  {
+    /*
+      We cannot unlock LOCK_log until we have locked LOCK_binlog_sync, nor
+      unlock LOCK_binlog_sync until we have locked LOCK_after_binlog_sync;
+      otherwise scheduling could allow the next group commit to run ahead of
+      us, messing up the order of binlog_end_pos updates and
+      commit_ordered() calls.
+    */
+    mysql_mutex_lock(&LOCK_binlog_sync);
+    mysql_mutex_unlock(&LOCK_log);
+    DEBUG_SYNC(leader->thd, "commit_after_release_LOCK_log");
 
-  DEBUG_SYNC(leader->thd, "commit_after_release_LOCK_log");
+    sync_group_commit(queue, binlog_id, commit_offset, need_sync, false);
+
+    mysql_mutex_lock(&LOCK_after_binlog_sync);
+    mysql_mutex_unlock(&LOCK_binlog_sync);
+  }
+  else
+  {
+    mysql_mutex_lock(&LOCK_after_binlog_sync);
+    /*
+      We cannot unlock LOCK_log until we have locked LOCK_after_binlog_sync;
+      otherwise scheduling could allow the next group commit to run ahead of
+      us, messing up the order of commit_ordered() calls. But as soon as
+      LOCK_after_binlog_sync is obtained, we can let the next group commit
+      start.
+    */
+    mysql_mutex_unlock(&LOCK_log);
+    DEBUG_SYNC(leader->thd, "commit_after_release_LOCK_log");
+  }
 
   /*
     Loop through threads and run the binlog_sync hook
@@ -8802,7 +9171,20 @@ MYSQL_BIN_LOG::write_transaction_or_stmt(group_commit_entry *entry,
                       DBUG_SUICIDE();
                     });
 
-    if (write_cache(entry->thd, mngr->get_binlog_cache_log(TRUE)))
+    if (mngr->trx_payload.length())
+    {
+      Transaction_payload_log_event
+        payload_ev(entry->thd, (uchar*) mngr->trx_payload.ptr(),
+                   mngr->trx_payload.length());
+      if (write_event(&payload_ev))
+      {
+        entry->error_cache= NULL;
+        DBUG_RETURN(ER_ERROR_ON_WRITE);
+      }
+      status_var_add(entry->thd->status_var.binlog_bytes_written,
+                     payload_ev.data_written);
+    }
+    else if (write_cache(entry->thd, mngr->get_binlog_cache_log(TRUE)))
     {
       entry->error_cache= &mngr->trx_cache.cache_log;
       DBUG_RETURN(ER_ERROR_ON_WRITE);
@@ -8867,6 +9249,13 @@ MYSQL_BIN_LOG::wait_for_sufficient_commits()
   mysql_mutex_assert_owner(&LOCK_log);
   mysql_mutex_assert_owner(&LOCK_prepare_ordered);
 
+  /*
+    While the previous group commit is in fsync(), this group will have to
+    wait for it after writing anyway, and more commits can queue up then.
+  */
+  if (group_commit_syncing)
+    return;
+
   for (e= last_head= group_commit_queue, count= 0; e; e= e->next)
   {
     if (++count >= opt_binlog_commit_wait_count)
@@ -9065,6 +9454,8 @@ void MYSQL_BIN_LOG::close(uint exiting)
   if (log_state == LOG_OPENED)
   {
     DBUG_ASSERT(log_type == LOG_BIN);
+    if (!is_relay_log)
+      wait_for_binlog_sync();
 #ifdef HAVE_REPLICATION
     if (exiting & LOG_CLOSE_STOP_EVENT)
     {
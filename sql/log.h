@@ -19,6 +19,7 @@
 
 #include "handler.h"                            /* my_xid */
 #include "rpl_constants.h"
+#include "my_atomic_wrapper.h"
 
 class Relay_log_info;
 
@@ -89,11 +90,12 @@ class TC_LOG
 */
 extern mysql_mutex_t LOCK_prepare_ordered;
 extern mysql_cond_t COND_prepare_ordered;
+extern mysql_mutex_t LOCK_binlog_sync;
 extern mysql_mutex_t LOCK_after_binlog_sync;
 extern mysql_mutex_t LOCK_commit_ordered;
 #ifdef HAVE_PSI_INTERFACE
 extern PSI_mutex_key key_LOCK_prepare_ordered, key_LOCK_commit_ordered;
-extern PSI_mutex_key key_LOCK_after_binlog_sync;
+extern PSI_mutex_key key_LOCK_binlog_sync, key_LOCK_after_binlog_sync;
 extern PSI_cond_key key_COND_prepare_ordered;
 #endif
 
@@ -551,6 +553,17 @@ class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
   */
   uint *sync_period_ptr;
   uint sync_counter;
+  /*
+    The binlog is durable up to binlog_synced_pos in the binlog file
+    binlog_synced_id; protected by LOCK_binlog_sync, or by LOCK_log when
+    no group commit is in the sync stage.
+  */
+  ulong binlog_synced_id;
+  my_off_t binlog_synced_pos;
+  /* End of the binlog as written by group commit, before the sync stage */
+  Atomic_relaxed<my_off_t> binlog_flushed_pos;
+  /* Whether sync_group_commit() is in fsync() */
+  Atomic_relaxed<bool> group_commit_syncing;
   bool state_file_deleted;
   bool binlog_state_recover_done;
 
@@ -573,6 +586,8 @@ class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
   int queue_for_group_commit(group_commit_entry *entry);
   bool write_transaction_to_binlog_events(group_commit_entry *entry);
   void trx_group_commit_leader(group_commit_entry *leader);
+  void sync_group_commit(group_commit_entry *queue, ulong binlog_id,
+                         my_off_t commit_offset, bool need_sync, bool error);
   bool is_xidlist_idle_nolock();
 public:
   /*
@@ -765,12 +780,26 @@ class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
     mysql_cond_broadcast(&COND_bin_log_updated);
     DBUG_VOID_RETURN;
   }
+  /*
+    Wait until no group commit is in its sync stage (holding
+    LOCK_binlog_sync), that is, until all of the binlog that was written
+    so far is durable and published to dump threads. As the caller holds
+    LOCK_log, no new group commit can enter the sync stage until LOCK_log
+    is released.
+  */
+  void wait_for_binlog_sync()
+  {
+    DBUG_ASSERT(!is_relay_log);
+    mysql_mutex_lock(&LOCK_binlog_sync);
+    mysql_mutex_unlock(&LOCK_binlog_sync);
+  }
   void update_binlog_end_pos()
   {
     if (is_relay_log)
       signal_relay_log_update();
     else
     {
+      wait_for_binlog_sync();
       lock_binlog_end_pos();
       binlog_end_pos= my_b_safe_tell(&log_file);
       signal_bin_log_update();
@@ -780,6 +809,16 @@ class MYSQL_BIN_LOG: public TC_LOG, private MYSQL_LOG
   void update_binlog_end_pos(my_off_t pos)
   {
     mysql_mutex_assert_owner(&LOCK_log);
+    wait_for_binlog_sync();
+    set_binlog_end_pos(pos);
+  }
+  /*
+    Publish the binlog up to pos to dump threads. The caller must be the
+    only one to write or sync the binlog: it holds LOCK_log after
+    wait_for_binlog_sync(), or it is in the sync stage of group commit.
+  */
+  void set_binlog_end_pos(my_off_t pos)
+  {
     mysql_mutex_assert_not_owner(&LOCK_binlog_end_pos);
     lock_binlog_end_pos();
     /*
@@ -1142,6 +1181,14 @@ enum enum_binlog_format {
   BINLOG_FORMAT_UNSPEC=3  ///< thd_binlog_format() returns it when binlog is closed
 };
 
+/** Values of binlog_transaction_dependency_tracking */
+enum enum_binlog_dependency_tracking {
+  /** commit_id groups the transactions of one binlog group commit */
+  BINLOG_DEPENDENCY_COMMIT_ORDER= 0,
+  /** commit_id also groups transactions whose unique keys do not overlap */
+  BINLOG_DEPENDENCY_WRITESET= 1
+};
+
 int query_error_code(THD *thd, bool not_killed);
 uint purge_log_get_error_code(int res);
 
@@ -701,6 +701,7 @@ const char* Log_event::get_type_str(Log_event_type type)
   case WRITE_ROWS_COMPRESSED_EVENT_V1: return "Write_rows_compressed_v1";
   case UPDATE_ROWS_COMPRESSED_EVENT_V1: return "Update_rows_compressed_v1";
   case DELETE_ROWS_COMPRESSED_EVENT_V1: return "Delete_rows_compressed_v1";
+  case TRANSACTION_PAYLOAD_EVENT: return "Transaction_payload";
 
   default: return "Unknown";				/* impossible */
   }
@@ -1036,7 +1037,8 @@ Log_event* Log_event::read_log_event(const uchar *buf, uint event_len,
   }
 
   if (event_type > fdle->number_of_event_types &&
-      event_type != FORMAT_DESCRIPTION_EVENT)
+      event_type != FORMAT_DESCRIPTION_EVENT &&
+      event_type != TRANSACTION_PAYLOAD_EVENT)
   {
     /*
       It is unsafe to use the fdle if its post_header_len
@@ -1190,6 +1192,9 @@ Log_event* Log_event::read_log_event(const uchar *buf, uint event_len,
     case START_ENCRYPTION_EVENT:
       ev= new Start_encryption_log_event(buf, event_len, fdle);
       break;
+    case TRANSACTION_PAYLOAD_EVENT:
+      ev= new Transaction_payload_log_event(buf, event_len, fdle);
+      break;
     case PRE_GA_WRITE_ROWS_EVENT:
     case PRE_GA_UPDATE_ROWS_EVENT:
     case PRE_GA_DELETE_ROWS_EVENT:
@@ -2951,7 +2956,7 @@ Rows_log_event::Rows_log_event(const uchar *buf, uint event_len,
     m_extra_row_data(0)
 #if !defined(MYSQL_CLIENT) && defined(HAVE_REPLICATION)
     , m_curr_row(NULL), m_curr_row_end(NULL),
-    m_key(NULL), m_key_info(NULL), m_key_nr(0),
+    m_key(NULL), m_key_info(NULL), m_key_nr(0), m_rows_hash(NULL),
     master_had_triggers(0)
 #endif
 {
@@ -3251,6 +3256,181 @@ bool Annotate_rows_log_event::is_valid() const
 }
 
 
+/**************************************************************************
+	Transaction_payload_log_event member functions
+**************************************************************************/
+
+#if !defined(MYSQL_CLIENT) && defined(HAVE_REPLICATION)
+/**
+  Copy a format description, without the decryption state.
+
+  Events inside a payload have no checksums of their own, so the copy
+  has checksums disabled.
+
+  @return the copy, or NULL if out of memory
+*/
+
+static Format_description_log_event *
+copy_payload_description_event(const Format_description_log_event *desc)
+{
+  Format_description_log_event *copy=
+    new Format_description_log_event(desc->binlog_version);
+  if (!copy->header_is_valid())
+  {
+    delete copy;
+    return NULL;
+  }
+  copy->number_of_event_types= MY_MIN(copy->number_of_event_types,
+                                      desc->number_of_event_types);
+  memcpy(copy->post_header_len, desc->post_header_len,
+         copy->number_of_event_types);
+  copy->common_header_len= desc->common_header_len;
+  memcpy(copy->server_version, desc->server_version, ST_SERVER_VER_LEN);
+  copy->server_version_split= desc->server_version_split;
+  copy->event_type_permutation= desc->event_type_permutation;
+  copy->options_written_to_bin_log= desc->options_written_to_bin_log;
+  copy->checksum_alg= BINLOG_CHECKSUM_ALG_OFF;
+  return copy;
+}
+#endif
+
+
+Transaction_payload_log_event::
+Transaction_payload_log_event(const uchar *buf, uint event_len,
+                              const Format_description_log_event *desc)
+  : Log_event(buf, desc), m_payload(0), m_payload_len(0),
+    m_description_event(0)
+{
+  if (event_len < desc->common_header_len + BODY_HEADER_LEN)
+    return;
+  m_payload_len= event_len - desc->common_header_len;
+  m_payload= buf + desc->common_header_len;
+  if (algorithm() != TRANSACTION_PAYLOAD_ZLIB)
+    m_payload= 0;                               // is_valid() fails
+#if !defined(MYSQL_CLIENT) && defined(HAVE_REPLICATION)
+  /*
+    The events of the payload are parsed when the event is applied, maybe
+    by a parallel replication worker after the SQL thread has moved on to
+    another relay log with a different format description.
+  */
+  else if (!(m_description_event= copy_payload_description_event(desc)))
+    m_payload= 0;
+#endif
+}
+
+
+Transaction_payload_reader::
+Transaction_payload_reader(const Transaction_payload_log_event *ev,
+                           const Format_description_log_event *fdle)
+  : m_event(ev), m_fdle(fdle), m_stream(0),
+    m_remaining(ev->uncompressed_length()), m_ok(false)
+{
+  if (!(m_stream= (z_stream*) my_malloc(PSI_INSTRUMENT_ME, sizeof(z_stream),
+                                        MYF(MY_WME | MY_ZEROFILL))))
+    return;
+  m_stream->next_in= (Bytef*) ev->m_payload +
+                     Transaction_payload_log_event::BODY_HEADER_LEN;
+  m_stream->avail_in= (uInt) (ev->m_payload_len -
+                              Transaction_payload_log_event::BODY_HEADER_LEN);
+  m_ok= inflateInit(m_stream) == Z_OK;
+}
+
+
+Transaction_payload_reader::~Transaction_payload_reader()
+{
+  if (m_stream)
+  {
+    if (m_ok)
+      inflateEnd(m_stream);
+    my_free(m_stream);
+  }
+}
+
+
+/**
+  Decompress exactly len bytes into dst.
+
+  @return true on error
+*/
+
+bool Transaction_payload_reader::inflate_to(uchar *dst, size_t len)
+{
+  if (len > m_remaining)
+    return true;
+  m_stream->next_out= dst;
+  m_stream->avail_out= (uInt) len;
+  while (m_stream->avail_out)
+  {
+    int res= inflate(m_stream, Z_NO_FLUSH);
+    if (res != Z_OK && (res != Z_STREAM_END || m_stream->avail_out))
+      return true;
+  }
+  m_remaining-= len;
+  return false;
+}
+
+
+Log_event *Transaction_payload_reader::next(const char **error)
+{
+  uchar header[LOG_EVENT_HEADER_LEN];
+  uint checksum_len= m_fdle->checksum_alg == BINLOG_CHECKSUM_ALG_CRC32 ?
+                     BINLOG_CHECKSUM_LEN : 0;
+  Log_event *ev;
+  uchar *buf;
+  uint32 len;
+
+  *error= NULL;
+  if (!m_ok)
+  {
+    *error= "Could not initialize decompression of transaction payload";
+    return NULL;
+  }
+  if (!m_remaining)
+    return NULL;
+
+  if (inflate_to(header, sizeof(header)) ||
+      (len= uint4korr(header + EVENT_LEN_OFFSET)) < LOG_EVENT_HEADER_LEN ||
+      len - LOG_EVENT_HEADER_LEN > m_remaining)
+    goto corrupt;
+
+  if (!(buf= (uchar*) my_malloc(PSI_INSTRUMENT_ME, len + checksum_len,
+                                MYF(MY_WME))))
+  {
+    *error= "Out of memory decompressing transaction payload";
+    m_ok= false;
+    return NULL;
+  }
+  memcpy(buf, header, sizeof(header));
+  if (inflate_to(buf + LOG_EVENT_HEADER_LEN, len - LOG_EVENT_HEADER_LEN))
+  {
+    my_free(buf);
+    goto corrupt;
+  }
+
+  int4store(buf + LOG_POS_OFFSET, m_event->log_pos);
+  if (checksum_len)
+  {
+    int4store(buf + EVENT_LEN_OFFSET, len + checksum_len);
+    int4store(buf + len, my_checksum(0L, buf, len));
+  }
+
+  if (!(ev= Log_event::read_log_event(buf, len + checksum_len, error, m_fdle,
+                                      FALSE)))
+  {
+    my_free(buf);
+    m_ok= false;
+    return NULL;
+  }
+  ev->register_temp_buf(buf, true);
+  return ev;
+
+corrupt:
+  *error= "Corrupt transaction payload";
+  m_ok= false;
+  return NULL;
+}
+
+
 /**************************************************************************
 	Table_map_log_event member functions and support functions
 **************************************************************************/
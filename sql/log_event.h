@@ -714,6 +714,12 @@ enum Log_event_type
   UPDATE_ROWS_COMPRESSED_EVENT = 170,
   DELETE_ROWS_COMPRESSED_EVENT = 171,
 
+  /*
+    A whole transaction (the content of the transaction cache) compressed
+    into one event. Used with binlog_transaction_compression=ON.
+  */
+  TRANSACTION_PAYLOAD_EVENT = 172,
+
   /* Add new MariaDB events here - right above this comment!  */
 
   ENUM_END_EVENT /* end marker */
@@ -786,8 +792,12 @@ static inline bool LOG_EVENT_IS_ROW_V2(enum Log_event_type type)
    The number of types we handle in Format_description_log_event (UNKNOWN_EVENT
    is not to be handled, it does not exist in binlogs, it does not have a
    format).
+
+   Events from TRANSACTION_PAYLOAD_EVENT on have no post-header and are not
+   described in the Format_description_log_event, so that its size (and
+   thereby every binlog offset) stays the same.
 */
-#define LOG_EVENT_TYPES (ENUM_END_EVENT-1)
+#define LOG_EVENT_TYPES (TRANSACTION_PAYLOAD_EVENT-1)
 
 enum Int_event_type
 {
@@ -1578,6 +1588,7 @@ class Log_event
     case USER_VAR_EVENT:
     case TABLE_MAP_EVENT:
     case ANNOTATE_ROWS_EVENT:
+    case TRANSACTION_PAYLOAD_EVENT:
       return true;
     case DELETE_ROWS_EVENT:
     case UPDATE_ROWS_EVENT:
@@ -3742,6 +3753,128 @@ class Annotate_rows_log_event: public Log_event
   bool  m_used_query_txt;
 };
 
+/**
+  @class Transaction_payload_log_event
+
+  With binlog_transaction_compression = ON, the events of a transaction
+  cache (Annotate_rows, Table_map, Rows and Query events) are written as
+  one Transaction_payload_log_event instead of one by one. The Gtid event
+  that starts the group and the Xid or COMMIT event that ends it are
+  written uncompressed around it, so group boundaries and GTID positions
+  are unchanged.
+
+  The event has no post-header. The body is
+
+  <table>
+  <tr><td>compression algorithm</td><td>1 byte</td>
+      <td>TRANSACTION_PAYLOAD_ZLIB (0)</td></tr>
+  <tr><td>uncompressed length</td><td>8 byte unsigned integer</td>
+      <td></td></tr>
+  <tr><td>payload</td><td>rest of the event</td>
+      <td>The compressed events, as they were in the transaction cache:
+          without checksums and with end_log_pos relative to the start
+          of the cache.</td></tr>
+  </table>
+
+  The payload is decompressed one event at a time with
+  Transaction_payload_reader, so a big transaction is never held
+  uncompressed in memory as a whole.
+*/
+class Transaction_payload_log_event: public Log_event
+{
+public:
+  enum enum_algorithm
+  {
+    TRANSACTION_PAYLOAD_ZLIB= 0
+  };
+  static const uint BODY_HEADER_LEN= 1 + 8;
+
+#ifndef MYSQL_CLIENT
+  Transaction_payload_log_event(THD*, const uchar *payload,
+                                size_t payload_len);
+#endif
+  Transaction_payload_log_event(const uchar *buf, uint event_len,
+                                const Format_description_log_event*);
+  ~Transaction_payload_log_event() { delete m_description_event; }
+
+  virtual int get_data_size() { return (int) m_payload_len; }
+  virtual Log_event_type get_type_code() { return TRANSACTION_PAYLOAD_EVENT; }
+  enum_logged_status logged_status() { return LOGGED_NO_DATA; }
+  virtual bool is_valid() const { return m_payload != NULL; }
+  virtual bool is_part_of_group() { return 1; }
+
+  uint algorithm() const { return m_payload[0]; }
+  ulonglong uncompressed_length() const { return uint8korr(m_payload + 1); }
+
+#ifndef MYSQL_CLIENT
+  virtual bool write_data_body();
+#endif
+
+#if !defined(MYSQL_CLIENT) && defined(HAVE_REPLICATION)
+  virtual void pack_info(Protocol*);
+#endif
+
+#ifdef MYSQL_CLIENT
+  virtual bool print(FILE*, PRINT_EVENT_INFO*);
+#endif
+
+#if !defined(MYSQL_CLIENT) && defined(HAVE_REPLICATION)
+private:
+  virtual int do_apply_event(rpl_group_info *rgi);
+  virtual int do_update_pos(rpl_group_info *rgi);
+  virtual enum_skip_reason do_shall_skip(rpl_group_info*);
+#endif
+
+private:
+  friend class Transaction_payload_reader;
+  const uchar *m_payload;
+  size_t m_payload_len;
+  /*
+    Copy of the format description of the binlog the event was read from,
+    to decode the events of the payload when it is applied. NULL if the
+    event was not read by the server from a relay log.
+  */
+  Format_description_log_event *m_description_event;
+};
+
+
+struct z_stream_s;
+
+/**
+  Decompresses the events of a Transaction_payload_log_event one at a
+  time.
+
+  Each event is given the end_log_pos of the payload event and, if the
+  format description says so, a checksum, so that it looks exactly as if
+  it had been written to the binlog on its own.
+*/
+class Transaction_payload_reader
+{
+public:
+  Transaction_payload_reader(const Transaction_payload_log_event *ev,
+                             const Format_description_log_event *fdle);
+  ~Transaction_payload_reader();
+
+  /**
+    Read the next event of the payload.
+
+    @param[out] error  Set to an error message if NULL is returned
+                       because of an error, NULL at end of payload.
+
+    @return The event, which owns its buffer, or NULL.
+  */
+  Log_event *next(const char **error);
+
+private:
+  bool inflate_to(uchar *dst, size_t len);
+
+  const Transaction_payload_log_event *m_event;
+  const Format_description_log_event *m_fdle;
+  struct z_stream_s *m_stream;
+  ulonglong m_remaining;
+  bool m_ok;
+};
+
 /**
   @class Table_map_log_event
 
@@ -4738,6 +4871,8 @@ class Rows_log_event : public Log_event
   uchar    *m_key;      /* Buffer to keep key value during searches */
   KEY      *m_key_info; /* Pointer to KEY info for m_key_nr */
   uint      m_key_nr;   /* Key number */
+  struct Rows_hash;
+  Rows_hash *m_rows_hash; /* Rows located by hash_rows(), or NULL */
   bool master_had_triggers;     /* set after tables opening */
 
   /*
@@ -4787,6 +4922,7 @@ class Rows_log_event : public Log_event
 
   int find_key(); // Find a best key to use in find_row()
   int find_row(rpl_group_info *);
+  int hash_rows(rpl_group_info *);
   int write_row(rpl_group_info *, const bool);
   int update_sequence();
 
@@ -2228,6 +2228,32 @@ bool Binlog_checkpoint_log_event::print(FILE *file,
 }
 
 
+/**
+  Print only the description of the payload; mysqlbinlog prints the
+  events inside it separately, with Transaction_payload_reader.
+*/
+
+bool
+Transaction_payload_log_event::print(FILE *file,
+                                     PRINT_EVENT_INFO *print_event_info)
+{
+  char llbuff[22];
+
+  if (print_event_info->short_form)
+    return 0;
+
+  Write_on_release_cache cache(&print_event_info->head_cache, file,
+                               Write_on_release_cache::FLUSH_F);
+
+  if (print_header(&cache, print_event_info, FALSE) ||
+      my_b_printf(&cache, "\tTransaction_payload\tcompression=zlib"
+                  "\tuncompressed_size=%s\n",
+                  ullstr(uncompressed_length(), llbuff)))
+    return 1;
+  return cache.flush_data();
+}
+
+
 bool
 Gtid_list_log_event::print(FILE *file, PRINT_EVENT_INFO *print_event_info)
 {
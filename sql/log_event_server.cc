@@ -4571,7 +4571,7 @@ Rows_log_event::Rows_log_event(THD *thd_arg, TABLE *tbl_arg, ulong tid,
     m_type(event_type), m_extra_row_data(0)
 #ifdef HAVE_REPLICATION
     , m_curr_row(NULL), m_curr_row_end(NULL),
-    m_key(NULL), m_key_info(NULL), m_key_nr(0),
+    m_key(NULL), m_key_info(NULL), m_key_nr(0), m_rows_hash(NULL),
     master_had_triggers(0)
 #endif
 {
@@ -5549,6 +5549,82 @@ Annotate_rows_log_event::do_shall_skip(rpl_group_info *rgi)
 }
 #endif
 
+
+/**************************************************************************
+	Transaction_payload_log_event member functions
+**************************************************************************/
+
+Transaction_payload_log_event::
+Transaction_payload_log_event(THD *thd_arg, const uchar *payload,
+                              size_t payload_len)
+  : Log_event(thd_arg, 0, true),
+    m_payload(payload), m_payload_len(payload_len), m_description_event(0)
+{
+}
+
+
+bool Transaction_payload_log_event::write_data_body()
+{
+  return write_data(m_payload, m_payload_len);
+}
+
+
+#if defined(HAVE_REPLICATION)
+void Transaction_payload_log_event::pack_info(Protocol *protocol)
+{
+  char buf[128], *pos;
+  pos= strmov(buf, "compression=zlib uncompressed_size=");
+  pos= longlong10_to_str(uncompressed_length(), pos, 10);
+  protocol->store(buf, (uint) (pos-buf), &my_charset_bin);
+}
+
+
+/**
+  Apply the events of the payload in order, exactly as the SQL thread
+  would have applied them had they been in the relay log one by one.
+*/
+
+int Transaction_payload_log_event::do_apply_event(rpl_group_info *rgi)
+{
+  const char *errmsg;
+  Log_event *ev;
+  int error= 0;
+
+  DBUG_ASSERT(m_description_event);
+  Transaction_payload_reader reader(this, m_description_event);
+  while (!error && (ev= reader.next(&errmsg)))
+  {
+    Log_event_type typ= ev->get_type_code();
+    ev->thd= thd;
+    if (!(error= ev->apply_event(rgi)))
+      error= ev->update_pos(rgi);
+    delete_or_keep_event_post_apply(rgi, typ, ev);
+  }
+  if (!error && errmsg)
+  {
+    rgi->rli->report(ERROR_LEVEL, ER_SLAVE_RELAY_LOG_READ_FAILURE,
+                     rgi->gtid_info(),
+                     ER_THD(thd, ER_SLAVE_RELAY_LOG_READ_FAILURE), errmsg);
+    error= 1;
+  }
+  return error;
+}
+
+
+int Transaction_payload_log_event::do_update_pos(rpl_group_info *rgi)
+{
+  rgi->inc_event_relay_log_pos();
+  return 0;
+}
+
+
+Log_event::enum_skip_reason
+Transaction_payload_log_event::do_shall_skip(rpl_group_info *rgi)
+{
+  return continue_group(rgi);
+}
+#endif
+
 /**************************************************************************
 	Table_map_log_event member functions and support functions
 **************************************************************************/
@@ -7209,6 +7285,294 @@ static int row_not_found_error(rpl_group_info *rgi)
          ? HA_ERR_KEY_NOT_FOUND : HA_ERR_RECORD_CHANGED;
 }
 
+
+/*
+  Computes a hash of table->record[0] that is equal for any two records
+  for which record_compare() returns FALSE.
+*/
+static uint32 record_hash(TABLE *table)
+{
+  Hasher hasher;
+
+  if ((table->s->blob_fields +
+       table->s->varchar_fields +
+       table->s->null_fields) == 0)
+    hasher.add(&my_charset_bin, table->record[0], table->s->reclength);
+  else
+  {
+    hasher.add(&my_charset_bin, table->null_flags, table->s->null_bytes);
+    for (Field **ptr=table->field ; *ptr ; ptr++)
+      if (!(*ptr)->is_null())
+        (*ptr)->hash_not_null(&hasher);
+  }
+
+  return hasher.finalize();
+}
+
+
+/**
+  The before images of a Delete_rows or Update_rows event, hashed by
+  record_hash(), and the positions of the rows that match them.
+  See Rows_log_event::hash_rows().
+*/
+struct Rows_log_event::Rows_hash
+{
+  struct entry
+  {
+    const uchar *row;   /* Start of the before image in the event */
+    uchar *record;      /* The unpacked before image */
+    uchar *ref;         /* handler::position() of the row, or NULL */
+    uint32 hash;        /* record_hash() of the before image */
+    uint next;          /* Next entry in the bucket, or UINT_MAX */
+  };
+
+  Dynamic_array<entry> entries; /* In the order of the event */
+  uint *buckets;                /* First entry of each bucket */
+  uint mask;                    /* Number of buckets - 1 */
+  uint n_missing;               /* Number of entries with ref == NULL */
+  uint cur;                     /* Next entry for fetch() */
+  MEM_ROOT mem_root;
+
+  Rows_hash()
+    : entries(PSI_INSTRUMENT_MEM, 64, 64), buckets(NULL), mask(0),
+      n_missing(0), cur(0)
+  {
+    init_alloc_root(PSI_INSTRUMENT_ME, &mem_root, 8192, 0,
+                    MYF(MY_THREAD_SPECIFIC));
+  }
+
+  ~Rows_hash()
+  {
+    free_root(&mem_root, MYF(0));
+  }
+
+  /**
+    Assign the row in table->record[0] to the first entry that has
+    not been located yet and whose before image matches it.
+  */
+  void match(TABLE *table)
+  {
+    const uint32 hash= record_hash(table);
+
+    for (uint i= buckets[hash & mask]; i != UINT_MAX; )
+    {
+      entry &e= entries.at(i);
+      if (!e.ref && e.hash == hash)
+      {
+        memcpy(table->record[1], e.record, table->s->reclength);
+        if (!record_compare(table))
+        {
+          if (!(e.ref= (uchar*) alloc_root(&mem_root,
+                                           table->file->ref_length)))
+            return;
+          table->file->position(table->record[0]);
+          memcpy(e.ref, table->file->ref, table->file->ref_length);
+          n_missing--;
+          return;
+        }
+      }
+      i= e.next;
+    }
+  }
+
+  /**
+    Fetch the row that was located for the before image that starts
+    at row and is unpacked in table->record[0].
+
+    @retval 0                   the row is in table->record[0], and the
+                                table is positioned on it for rnd_pos()
+    @retval HA_ERR_KEY_NOT_FOUND the row was not located, or it no
+                                longer matches the before image;
+                                table->record[0] is unchanged
+    @retval other               error from the storage engine
+  */
+  int fetch(TABLE *table, const uchar *row)
+  {
+    for (; cur < entries.elements(); cur++)
+      if (entries.at(cur).row >= row)
+        break;
+    if (cur == entries.elements() || entries.at(cur).row != row)
+      return HA_ERR_KEY_NOT_FOUND;
+
+    const uchar *ref= entries.at(cur++).ref;
+    if (!ref)
+      return HA_ERR_KEY_NOT_FOUND;
+
+    table->use_all_columns();
+    store_record(table, record[1]);
+    table->file->ha_index_or_rnd_end();
+    int error= table->file->ha_rnd_init(false);
+    if (likely(!error))
+    {
+      error= table->file->ha_rnd_pos(table->record[0], const_cast<uchar*>(ref));
+      if (likely(!error))
+      {
+        if (!record_compare(table))
+          return 0;
+        error= HA_ERR_KEY_NOT_FOUND;
+      }
+      table->file->ha_rnd_end();
+    }
+    restore_record(table, record[1]);
+    return error == HA_ERR_RECORD_DELETED ? HA_ERR_KEY_NOT_FOUND : error;
+  }
+};
+
+
+/**
+  Locate the rows of a Delete_rows or Update_rows event in a table that
+  can not be searched by a primary key or by a NOT NULL unique key.
+
+  Rather than scanning the table or a non-unique index once for each
+  row of the event in find_row(), hash the before images of all rows
+  of the event, read the table (or the index ranges of their keys)
+  once, and remember the position of each matching row, so that
+  find_row() can fetch it with handler::ha_rnd_pos(). Identical before
+  images are assigned to different rows. A row that is not located
+  here (for example, because it is created by an earlier row of the
+  same event) is searched for by find_row() as before.
+
+  The hash is only built if @@slave_rows_hash_scan is set, and only
+  for events that contain more than one row.
+
+  @returns Error code on failure, 0 on success (also if no hash
+  was built).
+*/
+int Rows_log_event::hash_rows(rpl_group_info *rgi)
+{
+  DBUG_ENTER("Rows_log_event::hash_rows");
+  DBUG_ASSERT(!m_rows_hash);
+  DBUG_ASSERT(m_curr_row == m_rows_buf);
+
+  TABLE *table= m_table;
+
+  if (!opt_slave_rows_hash_scan || table->versioned() ||
+      ((table->file->ha_table_flags() & HA_PRIMARY_KEY_REQUIRED_FOR_POSITION) &&
+       table->s->primary_key < MAX_KEY) ||
+      (m_key_info &&
+       (m_key_info->flags & (HA_NOSAME | HA_NULL_PART_KEY)) == HA_NOSAME))
+    DBUG_RETURN(0);
+
+  Rows_hash *hash= new Rows_hash;
+  const uchar *const curr_row= m_curr_row;
+  const uchar *const curr_row_end= m_curr_row_end;
+  int error= 0;
+
+  while (m_curr_row < m_rows_end)
+  {
+    Rows_hash::entry e;
+    prepare_record(table, m_width, FALSE);
+    if (unpack_current_row(rgi))
+      break;
+    e.row= m_curr_row;
+    e.ref= NULL;
+    e.hash= record_hash(table);
+    if (!(e.record= (uchar*) memdup_root(&hash->mem_root, table->record[0],
+                                         table->s->reclength)) ||
+        hash->entries.append(e))
+      break;
+    m_curr_row= m_curr_row_end;
+    if (get_general_type_code() == UPDATE_ROWS_EVENT)
+    {
+      if (unpack_current_row(rgi, &m_cols_ai))
+        break;
+      m_curr_row= m_curr_row_end;
+    }
+  }
+
+  const bool complete= m_curr_row == m_rows_end;
+  m_curr_row= curr_row;
+  m_curr_row_end= curr_row_end;
+  const uint n= (uint) hash->entries.elements();
+
+  /*
+    If the event could not be unpacked, let find_row() report it.
+    A single row is located by find_row() equally fast.
+  */
+  if (!complete || n < 2)
+  {
+    delete hash;
+    DBUG_RETURN(0);
+  }
+
+  hash->mask= my_round_up_to_next_power(n) * 2 - 1;
+  if (!(hash->buckets= (uint*) alloc_root(&hash->mem_root,
+                                          (hash->mask + 1) * sizeof(uint))))
+  {
+    delete hash;
+    DBUG_RETURN(0);
+  }
+  memset(hash->buckets, 0xff, (hash->mask + 1) * sizeof(uint));
+  /* Insert in reverse order, so that each bucket is in event order */
+  for (uint i= n; i--; )
+  {
+    Rows_hash::entry &e= hash->entries.at(i);
+    e.next= hash->buckets[e.hash & hash->mask];
+    hash->buckets[e.hash & hash->mask]= i;
+  }
+  hash->n_missing= n;
+
+  table->use_all_columns();
+
+  if (m_key_info)
+  {
+    DBUG_PRINT("info",("locating %u records using key #%u [%s]",
+                       n, m_key_nr, m_key_info->name.str));
+    if (likely(!(error= table->file->ha_index_init(m_key_nr, FALSE))))
+    {
+      /*
+        Read the index range of each key once, unless some of the
+        rows with that key were not found in it.
+      */
+      for (uint i= 0; hash->n_missing && i < n; i++)
+      {
+        if (hash->entries.at(i).ref)
+          continue;
+        key_copy(m_key, hash->entries.at(i).record, m_key_info, 0);
+        for (error= table->file->ha_index_read_map(table->record[0], m_key,
+                                                   HA_WHOLE_KEY,
+                                                   HA_READ_KEY_EXACT);
+             !error && (hash->match(table), hash->n_missing);
+             error= table->file->ha_index_next_same(table->record[0], m_key,
+                                                    m_key_info->key_length))
+        {}
+        if (error == HA_ERR_KEY_NOT_FOUND || error == HA_ERR_END_OF_FILE)
+          error= 0;
+        else if (error)
+          break;
+      }
+      table->file->ha_index_end();
+    }
+  }
+  else
+  {
+    DBUG_PRINT("info",("locating %u records using table scan", n));
+    if (likely(!(error= table->file->ha_rnd_init(true))))
+    {
+      while (hash->n_missing &&
+             !(error= table->file->ha_rnd_next(table->record[0])))
+        hash->match(table);
+      if (error == HA_ERR_END_OF_FILE)
+        error= 0;
+      table->file->ha_rnd_end();
+    }
+  }
+
+  if (unlikely(error))
+  {
+    DBUG_PRINT("info",("error: %s", HA_ERR(error)));
+    table->file->print_error(error, MYF(0));
+    delete hash;
+    DBUG_RETURN(error);
+  }
+
+  DBUG_PRINT("info",("%u of %u records not found", hash->n_missing, n));
+  m_rows_hash= hash;
+  issue_long_find_row_warning(get_general_type_code(), m_table->alias.c_ptr(),
+                              m_key_info != NULL, rgi);
+  DBUG_RETURN(0);
+}
+
 /**
   Locate the current row in event's table.
 
@@ -7250,6 +7614,9 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
   int error= 0;
   bool is_table_scan= false, is_index_scan= false;
 
+  if (m_curr_row == m_rows_buf && unlikely((error= hash_rows(rgi))))
+    DBUG_RETURN(error);
+
   /*
     rpl_row_tabledefs.test specifies that
     if the extra field on the slave does not have a default value
@@ -7279,6 +7646,19 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
   DBUG_PRINT("info",("looking for the following record"));
   DBUG_DUMP("record[0]", table->record[0], table->s->reclength);
 
+  if (m_rows_hash)
+  {
+    error= m_rows_hash->fetch(table, m_curr_row);
+    if (error != HA_ERR_KEY_NOT_FOUND)
+    {
+      if (unlikely(error))
+        table->file->print_error(error, MYF(0));
+      DBUG_RETURN(error);
+    }
+    DBUG_PRINT("info",("record was not located by hash_rows()"));
+    error= 0;
+  }
+
   if ((table->file->ha_table_flags() & HA_PRIMARY_KEY_REQUIRED_FOR_POSITION) &&
       table->s->primary_key < MAX_KEY)
   {
@@ -7579,6 +7959,8 @@ Delete_rows_log_event::do_after_row_operations(const Slave_reporting_capability
   my_free(m_key);
   m_key= NULL;
   m_key_info= NULL;
+  delete m_rows_hash;
+  m_rows_hash= NULL;
 
   return error;
 }
@@ -7741,6 +8123,8 @@ Update_rows_log_event::do_after_row_operations(const Slave_reporting_capability
   my_free(m_key); // Free for multi_malloc
   m_key= NULL;
   m_key_info= NULL;
+  delete m_rows_hash;
+  m_rows_hash= NULL;
 
   return error;
 }
@@ -127,6 +127,7 @@ extern ulong transactions_multi_engine;
 extern ulong rpl_transactions_multi_engine;
 extern ulong transactions_gtid_foreign_engine;
 extern ulong slave_run_triggers_for_rbr;
+extern my_bool opt_slave_rows_hash_scan;
 extern ulonglong slave_type_conversions_options;
 extern my_bool read_only, opt_readonly;
 extern MYSQL_PLUGIN_IMPORT my_bool lower_case_file_system;
@@ -241,6 +242,7 @@ extern ulong what_to_log,flush_time;
 extern uint max_prepared_stmt_count, prepared_stmt_count;
 extern MYSQL_PLUGIN_IMPORT ulong open_files_limit;
 extern ulonglong binlog_cache_size, binlog_stmt_cache_size, binlog_file_cache_size;
+extern ulonglong opt_binlog_dump_read_ahead_size;
 extern ulonglong max_binlog_cache_size, max_binlog_stmt_cache_size;
 extern ulong max_binlog_size;
 extern ulong slave_max_allowed_packet;
@@ -256,6 +258,9 @@ extern ulong opt_slave_parallel_max_queued;
 extern ulong opt_slave_parallel_mode;
 extern ulong opt_binlog_commit_wait_count;
 extern ulong opt_binlog_commit_wait_usec;
+extern ulong opt_binlog_transaction_dependency_tracking;
+extern ulong opt_binlog_transaction_dependency_history_size;
+extern my_bool opt_binlog_transaction_compression;
 extern my_bool opt_gtid_ignore_duplicates;
 extern uint opt_gtid_cleanup_batch_size;
 extern ulong back_log;
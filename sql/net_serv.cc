@@ -432,6 +432,28 @@ my_bool my_net_write(NET *net, const uchar *packet, size_t len)
 
   MYSQL_NET_WRITE_START(len);
 
+  /*
+    Fast path for packets (typically result set rows) that fit into the
+    free space of the write buffer: store header and payload in place
+    with a single copy, instead of going twice through net_write_buff().
+  */
+  if (likely(!net->compress && len < MAX_PACKET_LENGTH &&
+             len + NET_HEADER_SIZE <= (size_t) (net->buff_end -
+                                                net->write_pos)))
+  {
+    uchar *pos= net->write_pos;
+    int3store(pos, len);
+    pos[3]= (uchar) net->pkt_nr++;
+#ifdef DEBUG_DATA_PACKETS
+    DBUG_DUMP("data_written", packet, len);
+#endif
+    if (len)
+      memcpy(pos + NET_HEADER_SIZE, packet, len);
+    net->write_pos= pos + NET_HEADER_SIZE + len;
+    MYSQL_NET_WRITE_DONE(0);
+    return 0;
+  }
+
   /*
     Big packets are handled by splitting them in packets of MAX_PACKET_LENGTH
     length. The last packet is always a packet that is < MAX_PACKET_LENGTH.
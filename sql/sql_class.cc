@@ -7138,6 +7138,8 @@ int THD::binlog_write_row(TABLE* table, bool is_trans,
   if (variables.option_bits & OPTION_GTID_BEGIN)
     is_trans= 1;
 
+  binlog_writeset_add_row(table, is_trans, record, NULL);
+
   Rows_log_event* ev;
   if (binlog_should_compress(len))
     ev =
@@ -7173,6 +7175,9 @@ int THD::binlog_update_row(TABLE* table, bool is_trans,
   */
   MY_BITMAP *old_read_set= table->read_set;
 
+  binlog_writeset_add_row(table, is_trans, before_record, old_read_set);
+  binlog_writeset_add_row(table, is_trans, after_record, old_read_set);
+
   /**
      This will remove spurious fields required during execution but
      not needed for binlogging. This is done according to the:
@@ -7252,6 +7257,8 @@ int THD::binlog_delete_row(TABLE* table, bool is_trans,
   */
   MY_BITMAP *old_read_set= table->read_set;
 
+  binlog_writeset_add_row(table, is_trans, record, old_read_set);
+
   /** 
      This will remove spurious fields required during execution but
      not needed for binlogging. This is done according to the:
@@ -745,6 +745,7 @@ typedef struct system_variables
   ulong max_length_for_sort_data;
   ulong max_recursive_iterations;
   ulong max_sort_length;
+  ulong max_sort_threads;
   ulong max_tmp_tables;
   ulong max_insert_delayed_threads;
   ulong min_examined_row_limit;
@@ -851,6 +852,7 @@ typedef struct system_variables
   my_bool session_track_user_variables;
 #endif // USER_VAR_TRACKING
   my_bool tcp_nodelay;
+  my_bool optimizer_join_order_cache;
   plugin_ref table_plugin;
   plugin_ref tmp_table_plugin;
   plugin_ref enforced_table_plugin;
@@ -3079,6 +3081,10 @@ class THD: public THD_count, /* this must be first */
   void   set_binlog_flags_for_alter(uchar);
   uint64 get_binlog_start_alter_seq_no();
   void   set_binlog_start_alter_seq_no(uint64);
+
+  // Key hashes of binlog_transaction_dependency_tracking=WRITESET
+  void binlog_writeset_add_row(TABLE *table, bool is_trans,
+                               const uchar *record, const MY_BITMAP *cols);
 #endif /* MYSQL_CLIENT */
 
 public:
@@ -994,6 +994,8 @@ bool Explain_node::print_explain_json_cache(Json_writer *writer,
     {
       longlong cache_reads= cache_tracker->hit + cache_tracker->miss;
       writer->add_member("r_loops").add_ll(cache_reads);
+      writer->add_member("r_hits").add_ll(cache_tracker->hit);
+      writer->add_member("r_misses").add_ll(cache_tracker->miss);
       if (cache_reads != 0) 
       {
         double hit_ratio= double(cache_tracker->hit) / cache_reads * 100.0;
@@ -30,7 +30,10 @@
 #define EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE  0.2
 /**
   Number of cache miss to check hit ratio (maximum cache performance
-  impact in the case when the cache is not applicable)
+  impact in the case when the cache is not applicable). The check is
+  repeated after every such number of misses, using only the hits and
+  misses since the previous check, so that a cache that stops paying off
+  later during the execution is switched off as well.
 */
 #define EXPCACHE_CHECK_HIT_RATIO_AFTER 200
 
@@ -44,7 +47,7 @@ Expression_cache_tmptable::Expression_cache_tmptable(THD *thd,
                                                      List<Item> &dependants,
                                                      Item *value)
   :cache_table(NULL), table_thd(thd), tracker(NULL), items(dependants), val(value),
-   hit(0), miss(0), inited (0)
+   hit(0), miss(0), hit_at_check(0), miss_at_check(0), inited (0)
 {
   DBUG_ENTER("Expression_cache_tmptable::Expression_cache_tmptable");
   DBUG_VOID_RETURN;
@@ -225,13 +228,22 @@ Expression_cache::result Expression_cache_tmptable::check_value(Item **value)
 
     if (res)
     {
-      if (((++miss) == EXPCACHE_CHECK_HIT_RATIO_AFTER) &&
-          ((double)hit / ((double)hit + miss)) <
-          EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE)
+      if ((++miss - miss_at_check) == EXPCACHE_CHECK_HIT_RATIO_AFTER)
       {
-        DBUG_PRINT("info",
-                   ("Early check: hit rate is not so good to keep the cache"));
-        disable_cache();
+        double recent_hit= (double) (hit - hit_at_check);
+        if (recent_hit / (recent_hit + EXPCACHE_CHECK_HIT_RATIO_AFTER) <
+            EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE)
+        {
+          DBUG_PRINT("info",
+                     ("Periodic check: hit rate is not so good to keep the "
+                      "cache"));
+          disable_cache();
+        }
+        else
+        {
+          hit_at_check= hit;
+          miss_at_check= miss;
+        }
       }
 
       DBUG_RETURN(MISS);
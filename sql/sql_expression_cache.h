@@ -157,6 +157,8 @@ class Expression_cache_tmptable :public Expression_cache
   Item *val;
   /* hit/miss counters */
   ulong hit, miss;
+  /* hit/miss counters at the last check of the hit ratio */
+  ulong hit_at_check, miss_at_check;
   /* Set on if the object has been successfully initialized with init() */
   bool inited;
 };
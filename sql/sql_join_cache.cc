@@ -2847,7 +2847,8 @@ int JOIN_CACHE_HASHED::init(bool for_explain)
   DESCRIPTION
     The function estimates the number of hash table entries in the hash
     table to be used and initializes this hash table within the join buffer
-    space.
+    space. The number of entries is rounded down to a power of 2, so that
+    the hash functions can mask the hash value instead of dividing it.
 
   RETURN VALUE
     Currently the function always returns 0;
@@ -2882,6 +2883,7 @@ int JOIN_CACHE_HASHED::init_hash_table()
 
     hash_entries= (uint) (n / 0.7);
     set_if_bigger(hash_entries, 1);
+    hash_entries= my_round_up_to_next_power(hash_entries + 1) >> 1;
     
     if (offset_size((uint)(max_n*key_entry_length)) <=
         size_of_key_ofs)
@@ -3236,6 +3238,8 @@ bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
     The function calculates an index of the hash entry in the hash table
     of the join buffer for the given key. It considers the key just as
     a sequence of bytes of the length key_len.
+    The key is hashed with my_crc32c(), which uses the CRC32 instructions
+    of the CPU where available.
 
   RETURN VALUE
     the calculated index of the hash entry for the given key  
@@ -3244,16 +3248,7 @@ bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
 inline
 uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
 {
-  ulong nr= 1;
-  ulong nr2= 4;
-  uchar *pos= key;
-  uchar *end= key+key_len;
-  for (; pos < end ; pos++)
-  {
-    nr^= (ulong) ((((uint) nr & 63)+nr2)*((uint) *pos))+ (nr << 8);
-    nr2+= 3;
-  }
-  return nr % hash_entries;
+  return my_crc32c(0, key, key_len) & (hash_entries - 1);
 }
 
 
@@ -3284,7 +3279,8 @@ inline
 uint JOIN_CACHE_HASHED::get_hash_idx_complex(uchar *key, uint key_len)
 {
   return 
-    (uint) (key_hashnr(ref_key_info, ref_used_key_parts, key) % hash_entries);
+    (uint) (key_hashnr(ref_key_info, ref_used_key_parts, key) &
+            (hash_entries - 1));
 }
 
 
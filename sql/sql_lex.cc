@@ -2972,6 +2972,10 @@ void st_select_lex::init_query()
   n_sum_items= 0;
   n_child_sum_items= 0;
   hidden_bit_fields= 0;
+  cached_join_order= 0;
+  cached_join_rows= 0;
+  cached_join_tables= 0;
+  cached_join_capacity= 0;
   fields_in_window_functions= 0;
   changed_elements= 0;
   parsing_place= NO_MATTER;
@@ -1302,6 +1302,16 @@ class st_select_lex: public st_select_lex_node
    DISTINCT is converted to a GROUP BY involving BIT fields.
   */
   uint hidden_bit_fields;
+  /*
+    Join order of the non-constant tables chosen by an earlier execution
+    of a prepared statement, with the row estimates it was based on.
+    See optimizer_join_order_cache.
+  */
+  TABLE_LIST **cached_join_order;
+  double *cached_join_rows;
+  uint cached_join_tables;
+  /* Number of elements allocated for cached_join_order and cached_join_rows */
+  uint cached_join_capacity;
   /*
     Number of fields used in the definition of all the windows functions.
     This includes:
@@ -163,6 +163,9 @@ struct binlog_send_info {
   bool should_stop;
   size_t dirlen;
 
+  /** end of the range of the current binlog file already read ahead */
+  my_off_t read_ahead_end;
+
   binlog_send_info(THD *thd_arg, String *packet_arg, ushort flags_arg,
                    char *lfn)
     : thd(thd_arg), net(&thd_arg->net), packet(packet_arg),
@@ -180,7 +183,8 @@ struct binlog_send_info {
       hb_info_counter(0),
 #endif
       clear_initial_log_pos(false),
-      should_stop(false)
+      should_stop(false),
+      read_ahead_end(0)
   {
     error_text[0] = 0;
     bzero(&error_gtid, sizeof(error_gtid));
@@ -2664,6 +2668,49 @@ static my_off_t get_binlog_end_pos(binlog_send_info *info,
   return 0;
 }
 
+/**
+  Tell the kernel that a dump thread reads the binlog file sequentially.
+
+  All dump threads share the page cache of the binlog files, so this (and
+  binlog_read_ahead()) is what keeps a replica that is catching up from
+  older binlog files from waiting on one synchronous read per IO_CACHE
+  buffer.
+*/
+static void binlog_read_ahead_init(binlog_send_info *info, IO_CACHE *log)
+{
+  info->read_ahead_end= 0;
+#ifdef POSIX_FADV_SEQUENTIAL
+  if (opt_binlog_dump_read_ahead_size)
+    posix_fadvise(log->file, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+}
+
+
+/**
+  Start reading the next binlog_dump_read_ahead_size bytes in the
+  background, if the dump thread is that far behind end_pos.
+
+  A dump thread that follows the end of the active binlog reads what was
+  just written and is still in the page cache, so nothing is done then.
+*/
+static void binlog_read_ahead(binlog_send_info *info, IO_CACHE *log,
+                              my_off_t end_pos)
+{
+#ifdef POSIX_FADV_WILLNEED
+  my_off_t window= opt_binlog_dump_read_ahead_size;
+  my_off_t pos= my_b_tell(log);
+  my_off_t start;
+
+  if (!window || end_pos < pos + window ||
+      info->read_ahead_end >= pos + window / 2)
+    return;
+  start= MY_MAX(pos, info->read_ahead_end);
+  info->read_ahead_end= pos + window;
+  posix_fadvise(log->file, start, info->read_ahead_end - start,
+                POSIX_FADV_WILLNEED);
+#endif
+}
+
 /**
  * This function sends events from one binlog file
  * but only up until end_pos
@@ -2687,6 +2734,8 @@ static int send_events(binlog_send_info *info, IO_CACHE* log, LOG_INFO* linfo,
     if (should_stop(info))
       return 0;
 
+    binlog_read_ahead(info, log, end_pos);
+
     /* reset the transmit packet for the event read from binary log
        file */
     if (reset_transmit_packet(info, info->flags, &ev_offset, &info->errmsg))
@@ -2940,6 +2989,7 @@ void mysql_binlog_send(THD* thd, char* log_ident, my_off_t pos,
       info->error= ER_MASTER_FATAL_ERROR_READING_BINLOG;
       goto err;
     }
+    binlog_read_ahead_init(info, &log);
 
     if (send_format_descriptor_event(info, &log, &linfo, pos))
     {
@@ -6176,7 +6176,7 @@ make_join_statistics(JOIN *join, List<TABLE_LIST> &tables_list,
     /* Find an optimal join order of the non-constant tables. */
     if (join->const_tables != join->table_count)
     {
-      if (choose_plan(join, all_table_map & ~join->const_table_map, 0))
+      if (choose_plan(join, all_table_map & ~join->const_table_map, 0, true))
         goto error;
 
 #ifdef HAVE_valgrind
@@ -8308,6 +8308,57 @@ double hash_join_fanout(JOIN *join, JOIN_TAB *tab, table_map remaining_tables,
 }
 
 
+/*
+  @brief
+    Estimate the join buffer space used by the hash table of a hashed join
+    cache, per record put into the buffer
+
+  @param join             JOIN structure
+  @param tab              JOIN_TAB for the current table
+  @param remaining_tables Map of tables not yet accessable
+  @param hj_start_key     Pointer to hash key
+
+  @detail
+    Besides the records of the previous tables JOIN_CACHE_HASHED keeps a
+    key entry for every record (a copy of the key, a reference to the next
+    key and to the record chain) and a slot of the hash table, which is
+    sized for a fill factor of 0.7 (see JOIN_CACHE_HASHED::init_hash_table()).
+    This space is not accounted for in cache_record_length(), so without it
+    the number of join buffer refills, and thus the number of rescans of
+    the joined table, is underestimated for hash joins.
+    Only the estimate is adjusted here: the hashed join cache does not
+    partition its inputs or spill them to disk, so every refill still
+    costs a full rescan of the joined table.
+
+  @return
+    the estimated number of bytes
+*/
+
+static uint hash_join_cache_overhead(JOIN *join, JOIN_TAB *tab,
+                                     table_map remaining_tables,
+                                     KEYUSE *hj_start_key)
+{
+  uint key_length= 0;
+  uint prev_keypart= UINT_MAX;
+  for (KEYUSE *keyuse= hj_start_key;
+       keyuse->table == tab->table && is_hash_join_key_no(keyuse->key);
+       keyuse++)
+  {
+    if (keyuse->keypart != prev_keypart &&
+        !(remaining_tables & keyuse->used_tables) &&
+        (!keyuse->validity_ref || *keyuse->validity_ref) &&
+        tab->access_from_tables_is_allowed(keyuse->used_tables,
+                                           join->sjm_lookup_tables))
+    {
+      key_length+= tab->table->field[keyuse->keypart]->pack_length();
+      prev_keypart= keyuse->keypart;
+    }
+  }
+  /* key + next key reference + record chain references + hash slot */
+  return key_length + 3 * sizeof(uint32) + (uint) (sizeof(uint32) / 0.7);
+}
+
+
 /**
   Find the best access path for an extension of a partial execution
   plan and add this path to the plan.
@@ -9233,8 +9284,14 @@ best_access_path(JOIN      *join,
     else
       cur_cost= s->cached_scan_and_compare_time;
 
-    /* We read the table as many times as join buffer becomes full. */
-    refills= (1.0 + floor((double) cache_record_length(join,idx) *
+    /*
+      We read the table as many times as join buffer becomes full.
+      The hash table shares the join buffer with the records.
+    */
+    refills= (1.0 + floor((double) (cache_record_length(join,idx) +
+                                    hash_join_cache_overhead(join, s,
+                                                             remaining_tables,
+                                                             hj_start_key)) *
                           record_count /
                           (double) thd->variables.join_buff_size));
     cur_cost= COST_MULT(cur_cost, refills);
@@ -9815,6 +9872,112 @@ static void choose_initial_table_order(JOIN *join)
 }
 
 
+/*
+  The row estimate of a table may change this many times before a cached
+  join order is considered stale, see apply_cached_join_order()
+*/
+#define JOIN_ORDER_CACHE_MAX_ROWS_RATIO 2.0
+
+static bool join_order_cache_applicable(JOIN *join)
+{
+  THD *thd= join->thd;
+  return (thd->variables.optimizer_join_order_cache &&
+          !thd->stmt_arena->is_conventional() &&
+          !join->select_lex->sj_nests.elements &&
+          join->table_count - join->const_tables > 1);
+}
+
+
+/**
+  Put the non-constant tables in join->best_ref in the join order cached
+  by a previous execution of the statement.
+
+  The cached order is only used if the very same tables are non-constant
+  and the row estimate of every table is within
+  JOIN_ORDER_CACHE_MAX_ROWS_RATIO of the estimate the order was chosen
+  for. The latter catches both changed table statistics and parameter
+  values that select very different ranges.
+
+  @retval TRUE   best_ref is in the cached order
+  @retval FALSE  no usable cached order, best_ref is unchanged
+*/
+
+static bool apply_cached_join_order(JOIN *join)
+{
+  SELECT_LEX *select= join->select_lex;
+  uint n_tables= join->table_count - join->const_tables;
+  JOIN_TAB **order= join->best_ref + join->const_tables;
+
+  if (!select->cached_join_tables || select->cached_join_tables != n_tables)
+    return FALSE;
+
+  for (uint i= 0; i < n_tables; i++)
+  {
+    uint j;
+    for (j= 0; j < n_tables; j++)
+    {
+      if (order[j]->tab_list == select->cached_join_order[i])
+        break;
+    }
+    if (j == n_tables)
+      return FALSE;
+    double rows= (double) order[j]->found_records;
+    double cached_rows= select->cached_join_rows[i];
+    if (rows > cached_rows * JOIN_ORDER_CACHE_MAX_ROWS_RATIO ||
+        cached_rows > rows * JOIN_ORDER_CACHE_MAX_ROWS_RATIO)
+      return FALSE;
+  }
+
+  for (uint i= 0; i < n_tables; i++)
+  {
+    uint j= i;
+    while (order[j]->tab_list != select->cached_join_order[i])
+      j++;
+    swap_variables(JOIN_TAB*, order[i], order[j]);
+  }
+  return TRUE;
+}
+
+
+/**
+  Remember the join order found by the join order search, so that later
+  executions of the statement can skip the search.
+*/
+
+static void save_join_order(JOIN *join)
+{
+  THD *thd= join->thd;
+  SELECT_LEX *select= join->select_lex;
+  uint n_tables= join->table_count - join->const_tables;
+
+  if (n_tables > select->cached_join_capacity)
+  {
+    /*
+      Must survive the execution. table_count normally does not change
+      between executions, so this is allocated only once.
+    */
+    MEM_ROOT *mem_root= thd->stmt_arena->mem_root;
+    select->cached_join_tables= 0;
+    select->cached_join_capacity= 0;
+    if (!(select->cached_join_order= (TABLE_LIST**)
+          alloc_root(mem_root, sizeof(TABLE_LIST*) * join->table_count)) ||
+        !(select->cached_join_rows= (double*)
+          alloc_root(mem_root, sizeof(double) * join->table_count)))
+      return;
+    select->cached_join_capacity= join->table_count;
+  }
+  DBUG_ASSERT(n_tables <= select->cached_join_capacity);
+
+  for (uint i= 0; i < n_tables; i++)
+  {
+    JOIN_TAB *tab= join->best_positions[join->const_tables + i].table;
+    select->cached_join_order[i]= tab->tab_list;
+    select->cached_join_rows[i]= (double) tab->found_records;
+  }
+  select->cached_join_tables= n_tables;
+}
+
+
 /**
   Selects and invokes a search strategy for an optimal query plan.
 
@@ -9828,6 +9991,9 @@ static void choose_initial_table_order(JOIN *join)
                       the query
   @param join_tables  set of the tables in the query
   @param emb_sjm_nest List of tables in case of materialized semi-join nest
+  @param use_join_order_cache
+                      Reuse or remember the join order of a prepared
+                      statement, see optimizer_join_order_cache
 
   @retval
     FALSE       ok
@@ -9836,7 +10002,8 @@ static void choose_initial_table_order(JOIN *join)
 */
 
 bool
-choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest)
+choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest,
+            bool use_join_order_cache)
 {
   uint search_depth= join->thd->variables.optimizer_search_depth;
   uint use_cond_selectivity= 
@@ -9903,10 +10070,21 @@ choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest)
 
   join->cur_sj_inner_tables= 0;
 
+  if (use_join_order_cache && !straight_join && !emb_sjm_nest)
+    use_join_order_cache= join_order_cache_applicable(join);
+  else
+    use_join_order_cache= false;
+
   if (straight_join)
   {
     optimize_straight_join(join, join_tables);
   }
+  else if (use_join_order_cache && apply_cached_join_order(join))
+  {
+    if (unlikely(thd->trace_started()))
+      Json_writer_object(thd).add("cached_join_order", true);
+    optimize_straight_join(join, join_tables);
+  }
   else
   {
     DBUG_ASSERT(search_depth <= MAX_TABLES + 1);
@@ -9922,6 +10100,8 @@ choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest)
 
     if (greedy_search(join, join_tables, search_depth, use_cond_selectivity))
       DBUG_RETURN(TRUE);
+    if (use_join_order_cache)
+      save_join_order(join);
   }
 
   join->emb_sjm_nest= 0;
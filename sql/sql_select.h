@@ -2489,7 +2489,8 @@ inline Item * or_items(THD *thd, Item* cond, Item *item)
 {
   return (cond ? (new (thd->mem_root) Item_cond_or(thd, cond, item)) : item);
 }
-bool choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest);
+bool choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest,
+                 bool use_join_order_cache= false);
 void optimize_wo_join_buffering(JOIN *join, uint first_tab, uint last_tab, 
                                 table_map last_remaining_tables, 
                                 bool first_alt, uint no_jbuf_before,
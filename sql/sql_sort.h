@@ -573,6 +573,8 @@ class Sort_param {
   ha_rows *accepted_rows;         /* For ROWNUM */
   bool using_pq;
   bool set_all_read_bits;
+  /* Max number of threads used to sort a buffer, 0 or 1 means no threads */
+  uint max_sort_threads;
 
   uchar *unique_buff;
   bool not_killable;
@@ -550,6 +550,19 @@ Sys_binlog_file_cache_size(
        CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(IO_SIZE*2, SIZE_T_MAX), DEFAULT(IO_SIZE*4), BLOCK_SIZE(IO_SIZE));
 
+static Sys_var_on_access_global<Sys_var_ulonglong,
+                       PRIV_SET_SYSTEM_GLOBAL_VAR_BINLOG_DUMP_READ_AHEAD_SIZE>
+Sys_binlog_dump_read_ahead_size(
+       "binlog_dump_read_ahead_size",
+       "How far ahead of a binlog dump thread that is behind the end of "
+       "the binary log the file is read in the background, so that "
+       "replicas catching up from older binary logs are not limited by "
+       "read latency. 0 disables read-ahead",
+       GLOBAL_VAR(opt_binlog_dump_read_ahead_size),
+       CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, 1024*1024*1024), DEFAULT(2*1024*1024),
+       BLOCK_SIZE(IO_SIZE));
+
 static Sys_var_on_access_global<Sys_var_ulonglong,
                              PRIV_SET_SYSTEM_GLOBAL_VAR_BINLOG_STMT_CACHE_SIZE>
 Sys_binlog_stmt_cache_size(
@@ -2542,6 +2555,46 @@ Sys_binlog_commit_wait_usec(
        GLOBAL_VAR(opt_binlog_commit_wait_usec), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(0, ULONG_MAX), DEFAULT(100000), BLOCK_SIZE(1));
 
+static const char *binlog_transaction_dependency_tracking_names[]=
+  {"COMMIT_ORDER", "WRITESET", 0};
+static Sys_var_on_access_global<Sys_var_enum,
+       PRIV_SET_SYSTEM_GLOBAL_VAR_BINLOG_TRANSACTION_DEPENDENCY_TRACKING>
+Sys_binlog_transaction_dependency_tracking(
+       "binlog_transaction_dependency_tracking",
+       "How the commit_id of GTID events, which lets a slave in "
+       "slave_parallel_mode=conservative apply transactions in parallel, is "
+       "determined. COMMIT_ORDER (default) groups the transactions that were "
+       "group-committed together. WRITESET in addition groups consecutive "
+       "row-based transactions whose primary and unique key values do not "
+       "overlap, however they were committed.",
+       GLOBAL_VAR(opt_binlog_transaction_dependency_tracking),
+       CMD_LINE(REQUIRED_ARG), binlog_transaction_dependency_tracking_names,
+       DEFAULT(BINLOG_DEPENDENCY_COMMIT_ORDER));
+
+static Sys_var_on_access_global<Sys_var_ulong,
+       PRIV_SET_SYSTEM_GLOBAL_VAR_BINLOG_TRANSACTION_DEPENDENCY_HISTORY_SIZE>
+Sys_binlog_transaction_dependency_history_size(
+       "binlog_transaction_dependency_history_size",
+       "Maximum number of key hashes that "
+       "binlog_transaction_dependency_tracking=WRITESET remembers for one "
+       "group of transactions. A transaction that would exceed it starts a "
+       "new group.",
+       GLOBAL_VAR(opt_binlog_transaction_dependency_history_size),
+       CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, 1000000), DEFAULT(25000), BLOCK_SIZE(1));
+
+static Sys_var_on_access_global<Sys_var_mybool,
+       PRIV_SET_SYSTEM_GLOBAL_VAR_BINLOG_TRANSACTION_COMPRESSION>
+Sys_binlog_transaction_compression(
+       "binlog_transaction_compression",
+       "Write the events of each transaction to the binary log as one "
+       "zlib-compressed Transaction_payload event, if that makes it smaller. "
+       "Transactions that do not fit into binlog_cache_size are written "
+       "uncompressed. Replicas and mariadb-binlog older than this server cannot read such "
+       "binary logs",
+       GLOBAL_VAR(opt_binlog_transaction_compression), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 
 static bool fix_max_join_size(sys_var *self, THD *thd, enum_var_type type)
 {
@@ -2595,6 +2648,14 @@ static Sys_var_ulong Sys_max_sort_length(
        SESSION_VAR(max_sort_length), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(64, 8192*1024L), DEFAULT(1024), BLOCK_SIZE(1));
 
+static Sys_var_ulong Sys_max_sort_threads(
+       "max_sort_threads",
+       "Maximum number of threads used to sort a single buffer of sort keys "
+       "in filesort. 1 means that sorting is done by the connection thread "
+       "only",
+       SESSION_VAR(max_sort_threads), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, 256), DEFAULT(1), BLOCK_SIZE(1));
+
 static Sys_var_ulong Sys_max_sp_recursion_depth(
        "max_sp_recursion_depth",
        "Maximum stored procedure recursion depth",
@@ -2860,6 +2921,15 @@ static Sys_var_ulong Sys_optimizer_extra_pruning_depth(
        SESSION_VAR(optimizer_extra_pruning_depth), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(0, MAX_TABLES+1), DEFAULT(8), BLOCK_SIZE(1));
 
+static Sys_var_mybool Sys_optimizer_join_order_cache(
+       "optimizer_join_order_cache",
+       "Re-executions of prepared statements and stored routine statements "
+       "reuse the join order found by the previous join order search, as "
+       "long as the same tables are non-constant and their row estimates "
+       "did not change more than two times",
+       SESSION_VAR(optimizer_join_order_cache), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 /* this is used in the sigsegv handler */
 export const char *optimizer_switch_names[]=
 {
@@ -3491,6 +3561,18 @@ Slave_run_triggers_for_rbr(
        slave_run_triggers_for_rbr_names,
        DEFAULT(SLAVE_RUN_TRIGGERS_FOR_RBR_NO));
 
+static Sys_var_on_access_global<Sys_var_mybool,
+                              PRIV_SET_SYSTEM_GLOBAL_VAR_SLAVE_ROWS_HASH_SCAN>
+Slave_rows_hash_scan(
+       "slave_rows_hash_scan",
+       "When applying a row-based DELETE or UPDATE event to a table that "
+       "has no primary key or NOT NULL unique key, locate all rows of the "
+       "event with a single table scan (or a single read of each key of "
+       "the best non-unique index), matching them against a hash of the "
+       "before images, instead of searching once for each row",
+       GLOBAL_VAR(opt_slave_rows_hash_scan), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 static const char *slave_type_conversions_name[]= {"ALL_LOSSY", "ALL_NON_LOSSY", 0};
 static Sys_var_on_access_global<Sys_var_set,
                               PRIV_SET_SYSTEM_GLOBAL_VAR_SLAVE_TYPE_CONVERSIONS>
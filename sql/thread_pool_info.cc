@@ -35,6 +35,8 @@ static ST_FIELD_INFO groups_fields_info[] =
   Column("QUEUE_LENGTH",    SLong(6), NOT_NULL),
   Column("HAS_LISTENER",    STiny(1), NOT_NULL),
   Column("IS_STALLED",      STiny(1), NOT_NULL),
+  Column("STEALS",          SLonglong(19), NOT_NULL),
+  Column("QUEUEING_TIME_MICROSECONDS", SLonglong(19), NOT_NULL),
   CEnd()
 };
 
@@ -47,7 +49,7 @@ static int groups_fill_table(THD* thd, TABLE_LIST* tables, COND*)
     return 0;
 
   TABLE* table = tables->table;
-  for (uint i = 0; i < threadpool_max_size && all_groups[i].pollfd != INVALID_HANDLE_VALUE; i++)
+  for (uint i = 0; i < threadpool_max_size && all_groups[i].pollfd != INVALID_POLL_HANDLE; i++)
   {
     thread_group_t* group = &all_groups[i];
     /* ID */
@@ -68,6 +70,10 @@ static int groups_fill_table(THD* thd, TABLE_LIST* tables, COND*)
     table->field[6]->store((longlong)(group->listener != 0), true);
     /* IS_STALLED */
     table->field[7]->store(group->stalled, true);
+    /* STEALS */
+    table->field[8]->store(group->counters.steals, true);
+    /* QUEUEING_TIME_MICROSECONDS */
+    table->field[9]->store(group->counters.queueing_time, true);
 
     if (schema_table_store_record(thd, table))
       return 1;
@@ -108,7 +114,7 @@ static int queues_fill_table(THD* thd, TABLE_LIST* tables, COND*)
 
   TABLE* table = tables->table;
   for (uint group_id = 0;
-    group_id < threadpool_max_size && all_groups[group_id].pollfd != INVALID_HANDLE_VALUE;
+    group_id < threadpool_max_size && all_groups[group_id].pollfd != INVALID_POLL_HANDLE;
     group_id++)
   {
     thread_group_t* group = &all_groups[group_id];
@@ -185,7 +191,7 @@ static int stats_fill_table(THD* thd, TABLE_LIST* tables, COND*)
     return 0;
 
   TABLE* table = tables->table;
-  for (uint i = 0; i < threadpool_max_size && all_groups[i].pollfd != INVALID_HANDLE_VALUE; i++)
+  for (uint i = 0; i < threadpool_max_size && all_groups[i].pollfd != INVALID_POLL_HANDLE; i++)
   {
     table->field[0]->store(i, true);
     thread_group_t* group = &all_groups[i];
@@ -214,7 +220,7 @@ static int stats_reset_table()
   if (!all_groups)
     return 0;
 
-  for (uint i = 0; i < threadpool_max_size && all_groups[i].pollfd != INVALID_HANDLE_VALUE; i++)
+  for (uint i = 0; i < threadpool_max_size && all_groups[i].pollfd != INVALID_POLL_HANDLE; i++)
   {
     thread_group_t* group = &all_groups[i];
     mysql_mutex_lock(&group->mutex);
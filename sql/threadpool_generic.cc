@@ -36,6 +36,7 @@
 #define OPTIONAL_IO_POLL_READ_PARAM 0
 #endif
 
+#ifndef HAVE_THREADPOOL_URING
 static void io_poll_close(TP_file_handle fd)
 {
 #ifdef _WIN32
@@ -44,6 +45,7 @@ static void io_poll_close(TP_file_handle fd)
   close(fd);
 #endif
 }
+#endif
 
 /** Maximum number of native events a listener can read in one go */
 #define MAX_EVENTS 1024
@@ -93,6 +95,8 @@ static PSI_thread_info	thread_list[] =
 thread_group_t *all_groups;
 static uint group_count;
 static Atomic_counter<uint32_t> shutdown_group_count;
+/* Set when the pool starts to shut down, disables work stealing */
+static std::atomic<bool> pool_shutdown;
 
 /**
  Used for printing "pool blocked" message, see
@@ -168,9 +172,290 @@ static void print_pool_blocked_message(bool);
  native_event_get_userdata() function.
 
  On Linux: epoll_wait()
+
+ On Linux, if the server is built WITH_THREADPOOL_URING, io_uring is used
+ instead of epoll, see below.
+*/
+
+#if defined(HAVE_THREADPOOL_URING)
+#include <liburing.h>
+#include <sys/epoll.h>
+#include <poll.h>
+#include <mutex>
+
+/*
+  Sockets are armed with one-shot IORING_OP_POLL_ADD requests, the io_uring
+  counterpart of EPOLLONESHOT. Multishot poll requests would not need to be
+  re-armed, but they would also report a connection while a worker is
+  still executing its query.
+
+  Poll requests are only queued in the submission ring and submitted in
+  batches with one io_uring_enter() when a thread calls io_poll_wait().
+  Only while the listener is blocked waiting for completions, requests
+  are submitted at once, since nobody else would submit them. Completions
+  are reaped in batches straight from the shared completion ring.
+
+  If io_uring can not be used at runtime (old kernel, seccomp filters,
+  RLIMIT_MEMLOCK), the instance falls back to epoll.
+*/
+struct tp_uring
+{
+  struct io_uring ring;
+  /* Fallback epoll descriptor, -1 if io_uring is used */
+  int epoll_fd;
+  /* Submission ring is shared by all threads re-arming connections */
+  std::mutex sq_mutex;
+  /* Whether the listener is waiting for completions, under sq_mutex */
+  bool listener_waiting;
+  /* Completion ring is shared by the listener and polling workers */
+  std::mutex cq_mutex;
+};
+
+
+static TP_poll_handle io_poll_create()
+{
+  static bool fallback_reported;
+  tp_uring *p= new (std::nothrow) tp_uring;
+  if (!p)
+    return INVALID_POLL_HANDLE;
+  p->epoll_fd= -1;
+  p->listener_waiting= false;
+
+  int ret= io_uring_queue_init(MAX_EVENTS, &p->ring, 0);
+  if (!ret && !(p->ring.features & IORING_FEAT_NODROP))
+  {
+    /*
+      Armed connections can outnumber completion ring entries, which is
+      only safe if the kernel does not drop overflowing completions.
+    */
+    io_uring_queue_exit(&p->ring);
+    ret= -EOPNOTSUPP;
+  }
+  if (ret)
+  {
+    if (!fallback_reported)
+    {
+      fallback_reported= true;
+      sql_print_warning("Threadpool could not use io_uring (errno %d), "
+                        "falling back to epoll", -ret);
+    }
+    p->epoll_fd= epoll_create(1);
+    if (p->epoll_fd < 0)
+    {
+      delete p;
+      return INVALID_POLL_HANDLE;
+    }
+  }
+  return p;
+}
+
+
+static void io_poll_close(TP_poll_handle p)
+{
+  if (p->epoll_fd >= 0)
+    close(p->epoll_fd);
+  else
+    io_uring_queue_exit(&p->ring);
+  delete p;
+}
+
+
+static int io_poll_epoll_ctl(TP_poll_handle p, int op, TP_file_handle fd,
+                             void *data)
+{
+  struct epoll_event ev;
+  ev.data.u64= 0; /* Keep valgrind happy */
+  ev.data.ptr= data;
+  ev.events=  EPOLLIN|EPOLLET|EPOLLERR|EPOLLRDHUP|EPOLLONESHOT;
+  return epoll_ctl(p->epoll_fd, op, fd, &ev);
+}
+
+
+/*
+  Submit the queued poll requests, the caller holds sq_mutex.
+
+  With IORING_FEAT_NODROP the kernel refuses new requests with EBUSY
+  while completions are kept on its overflow list. The requests then stay
+  queued and are submitted again by the next io_poll_wait(), after the
+  completion ring has been drained.
+
+  @return 0 or -errno
 */
+static int io_poll_submit(TP_poll_handle p)
+{
+  if (!io_uring_sq_ready(&p->ring))
+    return 0;
+  int ret= io_uring_submit(&p->ring);
+  return ret < 0 && ret != -EBUSY ? ret : 0;
+}
+
+
+int io_poll_start_read(TP_poll_handle p, TP_file_handle fd, void *data, void *)
+{
+  if (p->epoll_fd >= 0)
+    return io_poll_epoll_ctl(p, EPOLL_CTL_MOD, fd, data);
+
+  std::lock_guard<std::mutex> lk(p->sq_mutex);
+  struct io_uring_sqe *sqe= io_uring_get_sqe(&p->ring);
+  if (!sqe)
+  {
+    /* The submission ring is full of queued requests */
+    int ret= io_uring_submit(&p->ring);
+    if (!(sqe= io_uring_get_sqe(&p->ring)))
+    {
+      errno= ret < 0 ? -ret : EBUSY;
+      return -1;
+    }
+  }
+  io_uring_prep_poll_add(sqe, fd, POLLIN|POLLRDHUP);
+  io_uring_sqe_set_data(sqe, data);
+  if (int ret= p->listener_waiting ? io_poll_submit(p) : 0)
+  {
+    errno= -ret;
+    return -1;
+  }
+  return 0;
+}
+
+
+int io_poll_associate_fd(TP_poll_handle p, TP_file_handle fd, void *data, void *opt)
+{
+  if (p->epoll_fd >= 0)
+    return io_poll_epoll_ctl(p, EPOLL_CTL_ADD, fd, data);
+  return io_poll_start_read(p, fd, data, opt);
+}
+
+
+int io_poll_disassociate_fd(TP_poll_handle p, TP_file_handle fd)
+{
+  if (p->epoll_fd >= 0)
+  {
+    struct epoll_event ev;
+    return epoll_ctl(p->epoll_fd, EPOLL_CTL_DEL, fd, &ev);
+  }
+  /*
+    Connections only change groups after their one-shot poll request
+    has completed, so there is nothing registered to remove.
+  */
+  return 0;
+}
+
+
+/*
+  Re-arm a connection whose poll request failed without the socket
+  becoming readable.
+
+  @param res  result of the poll request, a POLL* mask or -errno
+
+  Transient failures are retried. Any other error is passed on to the
+  worker like a readable socket, since reading from it fails at once.
+
+  @return whether the completion was consumed
+*/
+static bool io_poll_retry(TP_poll_handle p, void *data, int res)
+{
+  switch (res) {
+  case -EINTR:
+  case -EAGAIN:
+  case -ECANCELED:
+  case -ENOMEM:
+    break;
+  default:
+    return false;
+  }
+  TP_connection_generic *c= (TP_connection_generic *) data;
+  return !io_poll_start_read(p, c->fd, data, NULL);
+}
+
 
-#if defined (__linux__)
+/*
+  Listener waits (timeout_ms= -1), workers only peek (timeout_ms= 0).
+  Both submit the queued poll requests first.
+
+  The listener waits for completions without holding cq_mutex, waiting
+  does not consume them. Completions are only taken under cq_mutex, so a
+  worker may take those the listener was woken up for. A worker does not
+  wait for cq_mutex, it would not find anything the listener does not get.
+*/
+int io_poll_wait(TP_poll_handle p, native_event *native_events, int maxevents,
+                 int timeout_ms)
+{
+  int ret;
+  if (p->epoll_fd >= 0)
+  {
+    struct epoll_event ev[MAX_EVENTS];
+    do
+    {
+      ret= epoll_wait(p->epoll_fd, ev, std::min(maxevents, MAX_EVENTS),
+                      timeout_ms);
+    }
+    while (ret == -1 && errno == EINTR);
+    for (int i= 0; i < ret; i++)
+      native_events[i].data= ev[i].data.ptr;
+    return ret;
+  }
+
+  struct io_uring_cqe *cqes[MAX_EVENTS];
+  for (;;)
+  {
+    {
+      std::lock_guard<std::mutex> sq(p->sq_mutex);
+      if ((ret= io_poll_submit(p)))
+      {
+        errno= -ret;
+        return -1;
+      }
+      if (timeout_ms)
+        p->listener_waiting= true;
+    }
+    if (timeout_ms)
+    {
+      do
+        ret= io_uring_wait_cqe(&p->ring, cqes);
+      while (ret == -EINTR);
+      p->sq_mutex.lock();
+      p->listener_waiting= false;
+      p->sq_mutex.unlock();
+      if (ret < 0)
+      {
+        errno= -ret;
+        return -1;
+      }
+    }
+
+    std::unique_lock<std::mutex> lk(p->cq_mutex, std::defer_lock);
+    if (timeout_ms)
+      lk.lock();
+    else if (!lk.try_lock())
+      return 0;
+    unsigned n= io_uring_peek_batch_cqe(&p->ring, cqes,
+                                        std::min(maxevents, MAX_EVENTS));
+    ret= 0;
+    for (unsigned i= 0; i < n; i++)
+    {
+      void *data= io_uring_cqe_get_data(cqes[i]);
+      if (data && io_poll_retry(p, data, cqes[i]->res))
+        continue;
+      native_events[ret++].data= data;
+    }
+    io_uring_cq_advance(&p->ring, n);
+    lk.unlock();
+    /*
+      The listener treats 0 events as shutdown. It also gets here when
+      all completions were re-armed or taken by a worker.
+    */
+    if (ret || !timeout_ms)
+      return ret;
+  }
+}
+
+
+static void *native_event_get_userdata(native_event *event)
+{
+  return event->data;
+}
+
+#elif defined (__linux__)
 #ifndef EPOLLRDHUP
 /* Early 2.6 kernel did not have EPOLLRDHUP */
 #define EPOLLRDHUP 0
@@ -454,7 +739,12 @@ static TP_connection_generic *queue_get(thread_group_t *thread_group)
   {
     c= thread_group->queues[i].pop_front();
     if (c)
+    {
+      ulonglong now= pool_timer.current_microtime;
+      if (now > c->enqueue_time)
+        thread_group->counters.queueing_time+= now - c->enqueue_time;
       DBUG_RETURN(c);
+    }
   }
   DBUG_RETURN(0);
 }
@@ -480,6 +770,25 @@ static bool is_queue_empty(thread_group_t *thread_group)
 }
 
 
+/*
+  Check whether the oldest event in the group's queues has been waiting
+  for longer than the stall limit.
+*/
+
+static bool is_queue_too_old(thread_group_t *thread_group)
+{
+  for (int i=0; i < NQUEUES; i++)
+  {
+    TP_connection_generic *c= thread_group->queues[i].front();
+    if (c && pool_timer.current_microtime > c->enqueue_time &&
+        pool_timer.current_microtime - c->enqueue_time >
+        1000ULL * threadpool_stall_limit)
+      return true;
+  }
+  return false;
+}
+
+
 static void queue_init(thread_group_t *thread_group)
 {
   for (int i=0; i < NQUEUES; i++)
@@ -653,7 +962,9 @@ void check_stall(thread_group_t *thread_group)
     1. There is a counter thread_group->queue_event_count for the number of
        events removed from the queue. Timer resets the counter to 0 on each run.
     2. Timer determines stall if this counter remains 0 since last check
-       and the queue is not empty.
+       and the queue is not empty, or if the oldest event in the queue has
+       already waited for longer than thread_pool_stall_limit (queue is
+       being dequeued, but too slowly).
     3. Once timer determined a stall it sets thread_group->stalled flag and
        wakes and idle worker (or creates a new one, subject to throttling).
     4. The stalled flag is reset, when an event is dequeued.
@@ -671,7 +982,8 @@ void check_stall(thread_group_t *thread_group)
     do wait and indicate that via thd_wait_begin/end callbacks, thread creation
     will be faster.
   */
-  if (!is_queue_empty(thread_group) && !thread_group->queue_event_count)
+  if (!is_queue_empty(thread_group) &&
+      (!thread_group->queue_event_count || is_queue_too_old(thread_group)))
   {
     thread_group->stalled= true;
     TP_INCREMENT_GROUP_COUNTER(thread_group,stalls);
@@ -986,7 +1298,7 @@ int thread_group_init(thread_group_t *thread_group, pthread_attr_t* thread_attr)
   DBUG_ENTER("thread_group_init");
   thread_group->pthread_attr = thread_attr;
   mysql_mutex_init(key_group_mutex, &thread_group->mutex, NULL);
-  thread_group->pollfd= INVALID_HANDLE_VALUE;
+  thread_group->pollfd= INVALID_POLL_HANDLE;
   thread_group->shutdown_pipe[0]= -1;
   thread_group->shutdown_pipe[1]= -1;
   queue_init(thread_group);
@@ -997,10 +1309,10 @@ int thread_group_init(thread_group_t *thread_group, pthread_attr_t* thread_attr)
 void thread_group_destroy(thread_group_t *thread_group)
 {
   mysql_mutex_destroy(&thread_group->mutex);
-  if (thread_group->pollfd != INVALID_HANDLE_VALUE)
+  if (thread_group->pollfd != INVALID_POLL_HANDLE)
   {
     io_poll_close(thread_group->pollfd);
-    thread_group->pollfd= INVALID_HANDLE_VALUE;
+    thread_group->pollfd= INVALID_POLL_HANDLE;
   }
 #ifndef _WIN32
   for(int i=0; i < 2; i++)
@@ -1139,6 +1451,59 @@ static bool too_many_threads(thread_group_t *thread_group)
 }
 
 
+/*
+  Work stealing: take a queued connection from another group whose workers
+  are all busy, and move the connection to the calling (idle) group.
+
+  Groups are visited round robin, starting after the caller's group. A
+  group is only robbed if it has at least as many active threads as
+  too_many_threads() allows, i.e if it cannot dequeue the event itself.
+  Group mutexes are only try-locked, so that stealing never waits and
+  never contends with a group that is busy with its own queue.
+
+  The connection migrates to the new group the same way as in
+  change_group(): it is removed from the old group's poll descriptor and
+  will be associated with the new one in start_io().
+
+  Must be called without holding thread_group->mutex.
+
+  @return connection with pending event, NULL if nothing could be stolen
+*/
+
+static TP_connection_generic *steal_event(thread_group_t *thread_group)
+{
+  uint n_groups= group_count;
+  uint self= (uint) (thread_group - all_groups);
+
+  if (n_groups < 2 || self >= n_groups || pool_shutdown)
+    return NULL;
+
+  for (uint i= 1; i < n_groups; i++)
+  {
+    thread_group_t *victim= &all_groups[(self + i) % n_groups];
+    TP_connection_generic *c= NULL;
+
+    if (mysql_mutex_trylock(&victim->mutex))
+      continue;
+    if (!victim->shutdown &&
+        victim->active_thread_count >= 1 + (int) threadpool_oversubscribe &&
+        (c= queue_get(victim, operation_origin::WORKER)))
+    {
+      if (c->bound_to_poll_descriptor)
+      {
+        io_poll_disassociate_fd(victim->pollfd, c->fd);
+        c->bound_to_poll_descriptor= false;
+      }
+      victim->connection_count--;
+    }
+    mysql_mutex_unlock(&victim->mutex);
+    if (c)
+      return c;
+  }
+  return NULL;
+}
+
+
 /**
   Retrieve a connection with pending event.
 
@@ -1219,6 +1584,27 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
       }
     }
 
+    /* Help out overloaded groups before going to sleep */
+    if (!oversubscribed)
+    {
+      mysql_mutex_unlock(&thread_group->mutex);
+      connection= steal_event(thread_group);
+      mysql_mutex_lock(&thread_group->mutex);
+      if (connection)
+      {
+        connection->thread_group= thread_group;
+        thread_group->connection_count++;
+        TP_INCREMENT_GROUP_COUNTER(thread_group, steals);
+        break;
+      }
+      /*
+        The listener does not wake anyone while this thread still counts as
+        active, so pick up whatever was queued while the mutex was released.
+      */
+      if ((connection= queue_get(thread_group, operation_origin::WORKER)))
+        break;
+    }
+
 
     /* And now, finally sleep */
     current_thread->woken = false; /* wake() sets this to true */
@@ -1618,6 +2004,7 @@ TP_pool_generic::~TP_pool_generic()
     DBUG_VOID_RETURN;
 
   stop_timer(&pool_timer);
+  pool_shutdown= true;
   shutdown_group_count= threadpool_max_size;
   for (uint i= 0; i < threadpool_max_size; i++)
   {
@@ -1653,10 +2040,10 @@ int TP_pool_generic::set_pool_size(uint size)
   {
     thread_group_t *group= &all_groups[i];
     mysql_mutex_lock(&group->mutex);
-    if (group->pollfd == INVALID_HANDLE_VALUE)
+    if (group->pollfd == INVALID_POLL_HANDLE)
     {
       group->pollfd= io_poll_create();
-      success= (group->pollfd != INVALID_HANDLE_VALUE);
+      success= (group->pollfd != INVALID_POLL_HANDLE);
       if(!success)
       {
         sql_print_error("io_poll_create() failed, errno=%d", errno);
@@ -1694,7 +2081,7 @@ int TP_pool_generic::set_stall_limit(uint limit)
 int TP_pool_generic::get_idle_thread_count()
 {
   int sum=0;
-  for (uint i= 0; i < threadpool_max_size && all_groups[i].pollfd != INVALID_HANDLE_VALUE; i++)
+  for (uint i= 0; i < threadpool_max_size && all_groups[i].pollfd != INVALID_POLL_HANDLE; i++)
   {
     sum+= (all_groups[i].thread_count - all_groups[i].active_thread_count);
   }
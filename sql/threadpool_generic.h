@@ -36,7 +36,15 @@ typedef int TP_file_handle;
 #define  INVALID_HANDLE_VALUE -1
 #endif
 
-#ifdef __linux__
+#ifdef HAVE_THREADPOOL_URING
+/* io_uring instance, or epoll if io_uring is unusable at runtime */
+struct tp_uring;
+struct tp_uring_event
+{
+  void *data;
+};
+typedef struct tp_uring_event native_event;
+#elif defined(__linux__)
 #include <sys/epoll.h>
 typedef struct epoll_event native_event;
 #elif defined(HAVE_KQUEUE)
@@ -51,6 +59,14 @@ typedef OVERLAPPED_ENTRY native_event;
 #error threadpool is not available on this platform
 #endif
 
+#ifdef HAVE_THREADPOOL_URING
+typedef struct tp_uring *TP_poll_handle;
+#define INVALID_POLL_HANDLE NULL
+#else
+typedef TP_file_handle TP_poll_handle;
+#define INVALID_POLL_HANDLE INVALID_HANDLE_VALUE
+#endif
+
 struct thread_group_t;
 
 /* Per-thread structure for workers */
@@ -126,6 +142,10 @@ struct thread_group_counters_t
   ulonglong stalls;
   ulonglong dequeues[2];
   ulonglong polls[2];
+  /* Connections taken over from the queues of other, overloaded groups */
+  ulonglong steals;
+  /* Total time dequeued events spent in the queue, in microseconds */
+  ulonglong queueing_time;
 };
 
 struct thread_group_t
@@ -135,7 +155,7 @@ struct thread_group_t
   worker_list_t waiting_threads;
   worker_thread_t* listener;
   pthread_attr_t* pthread_attr;
-  TP_file_handle  pollfd;
+  TP_poll_handle  pollfd;
   int  thread_count;
   int  active_thread_count;
   int  connection_count;
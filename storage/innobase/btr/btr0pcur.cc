@@ -28,6 +28,8 @@ Created 2/23/1996 Heikki Tuuri
 #include "ut0byte.h"
 #include "rem0cmp.h"
 #include "trx0trx.h"
+#include "buf0rea.h"
+#include "srv0srv.h"
 
 /**************************************************************//**
 Resets a persistent cursor object, freeing ::old_rec_buf if it is
@@ -499,6 +501,131 @@ btr_pcur_t::restore_position(btr_latch_mode restore_latch_mode, mtr_t *mtr)
 	return ret_val;
 }
 
+/** Look up the leaf pages that follow a leaf page in the index, via the
+node pointers on the parent level. The pages are only latched with
+buf_page_try_get(), because the caller is holding a leaf page latch.
+@param index  B-tree
+@param leaf   latched leaf page
+@param next   the next page of leaf, which will be read by the caller
+@param pages  page numbers of the following leaf pages
+@param n      maximum number of elements in pages[]
+@return number of elements written to pages[] */
+static ulint btr_read_ahead_find(dict_index_t *index, const buf_block_t &leaf,
+                                 uint32_t next, uint32_t *pages, ulint n)
+{
+  const rec_t *rec=
+    page_rec_get_next_const(page_get_infimum_rec(leaf.page.frame));
+  if (!rec || !page_rec_is_user_rec(rec))
+    return 0;
+
+  mem_heap_t *heap= mem_heap_create(256);
+  rec_offs offsets_[REC_OFFS_NORMAL_SIZE];
+  rec_offs *offsets= offsets_;
+  rec_offs_init(offsets_);
+  const dtuple_t *tuple= dict_index_build_node_ptr(index, rec, 0, heap, 0);
+  page_id_t page_id{index->table->space_id, index->page};
+  page_cur_t cur{index, nullptr, nullptr, nullptr};
+  ulint n_pages= 0;
+  mtr_t mtr;
+  mtr.start();
+
+  for (ulint height= ULINT_UNDEFINED;; height--)
+  {
+    buf_block_t *block= buf_page_try_get(page_id, &mtr);
+    if (!block || btr_page_get_index_id(block->page.frame) != index->id)
+      goto func_exit;
+    const ulint level= btr_page_get_level(block->page.frame);
+    if (height == ULINT_UNDEFINED)
+      height= level;
+    if (!level || level != height)
+      goto func_exit;
+    cur.block= block;
+    ulint up_match= 0, low_match= 0;
+    if (page_cur_search_with_match(tuple, PAGE_CUR_LE, &up_match, &low_match,
+                                   &cur, nullptr))
+      goto func_exit;
+    if (level == 1)
+      break;
+    offsets= rec_get_offsets(cur.rec, index, offsets, 0, ULINT_UNDEFINED,
+                             &heap);
+    page_id.set_page_no(btr_node_ptr_get_child_page_no(cur.rec, offsets));
+  }
+
+  for (rec= cur.rec; n_pages < n; )
+  {
+    if (!(rec= page_rec_get_next_const(rec)))
+      break;
+    if (page_rec_is_supremum(rec))
+    {
+      /* Continue on the right sibling of the parent page. */
+      page_id.set_page_no(btr_page_get_next(cur.block->page.frame));
+      if (page_id.page_no() == FIL_NULL)
+        break;
+      cur.block= buf_page_try_get(page_id, &mtr);
+      if (!cur.block ||
+          btr_page_get_index_id(cur.block->page.frame) != index->id ||
+          btr_page_get_level(cur.block->page.frame) != 1)
+        break;
+      rec= page_get_infimum_rec(cur.block->page.frame);
+      continue;
+    }
+    offsets= rec_get_offsets(rec, index, offsets, 0, ULINT_UNDEFINED, &heap);
+    const uint32_t child= btr_node_ptr_get_child_page_no(rec, offsets);
+    if (child != next)
+      pages[n_pages++]= child;
+  }
+
+func_exit:
+  mtr.commit();
+  mem_heap_free(heap);
+  return n_pages;
+}
+
+/** Read ahead the leaf pages of a forward scan. Once the cursor has moved
+to the next page several times in a row, submit asynchronous reads for
+the following leaf pages. The number of pages is doubled whenever the
+scan catches up with a read that is still in progress.
+@param cursor  persistent cursor on the last record of a leaf page
+@param next    the next leaf page */
+static void btr_pcur_read_ahead(btr_pcur_t *cursor, uint32_t next)
+{
+  const ulint max_depth= srv_read_ahead_leaf_pages;
+  auto &ra= cursor->read_ahead;
+  const buf_block_t &block= *btr_pcur_get_block(cursor);
+  dict_index_t *index= cursor->index();
+
+  if (ra.leaf != block.page.id().page_no() || !max_depth ||
+      index->table->is_temporary())
+  {
+    /* This is not a continuation of a forward scan. */
+    ra.leaf= next;
+    ra.n_moves= 0;
+    ra.ahead= 0;
+    ra.depth= uint32_t(std::min<ulint>(8, max_depth));
+    return;
+  }
+
+  ra.leaf= next;
+  ra.depth= uint32_t(std::min<ulint>(std::max(ra.depth, 1U), max_depth));
+
+  if (ra.ahead)
+  {
+    ra.ahead--;
+    if (buf_read_in_progress(page_id_t{block.page.id().space(), next}))
+      /* The read-ahead is not keeping up with the scan. */
+      ra.depth= uint32_t(std::min<ulint>(ra.depth * 2, max_depth));
+  }
+
+  if (++ra.n_moves < 2 || ra.ahead > ra.depth / 2)
+    return;
+
+  uint32_t pages[BTR_READ_AHEAD_MAX];
+  ra.ahead= uint32_t(btr_read_ahead_find(index, block, next, pages, ra.depth));
+  if (ra.ahead)
+    buf_read_ahead_pages(block.page.id().space(), pages, ra.ahead,
+                         block.zip_size());
+}
+
 /*********************************************************//**
 Moves the persistent cursor to the first record on the next page. Releases the
 latch on the current page, and bufferunfixes it. Note that there must not be
@@ -532,6 +659,8 @@ btr_pcur_move_to_next_page(
 		return DB_CORRUPTION;
 	}
 
+	btr_pcur_read_ahead(cursor, next_page_no);
+
 	dberr_t err;
 	buf_block_t* next_block = btr_block_get(
 		*cursor->index(), next_page_no,
@@ -1022,6 +1022,91 @@ inline buf_block_t* buf_pool_t::block_from_ahi(const byte *ptr) const
   return block;
 }
 
+/** Update the search info after a successful hash search.
+@param[in,out]	info	index search info */
+static void btr_search_success(btr_search_t *info)
+{
+  if (info->n_hash_potential < BTR_SEARCH_BUILD_LIMIT + 5)
+    info->n_hash_potential++;
+
+  info->last_hash_succ= TRUE;
+
+#ifdef UNIV_SEARCH_PERF_STAT
+  btr_search_n_succ++;
+#endif
+}
+
+/** Look up a search key in btr_search_sys_t::partition::guesses[]
+without acquiring btr_search_sys_t::partition::latch.
+@param index       index tree
+@param part        adaptive hash index partition
+@param fold        dtuple_fold() of the search key
+@param latch_mode  BTR_SEARCH_LEAF or BTR_MODIFY_LEAF
+@param mtr         mini-transaction
+@return the cached record, in a page that was latched and buffer-fixed
+@retval nullptr if the cached position could not be validated */
+TRANSACTIONAL_TARGET
+static const rec_t *btr_search_guess_cached(const dict_index_t &index,
+                                            const btr_search_sys_t::partition
+                                            &part, ulint fold,
+                                            ulint latch_mode, mtr_t *mtr)
+{
+  page_id_t id{0};
+  buf_block_t *block;
+  uint64_t modify_clock;
+  uint16_t offset;
+
+  if (!part.guess_get(fold, id, block, modify_clock, offset))
+    return nullptr;
+
+  /* The entry may refer to a block that has been freed by
+  buf_pool_t::resize() or reused for a different page. Like
+  buf::Block_hint::buffer_fix_block_if_still_valid(), validate the
+  block while holding the page_hash latch, which buf_pool_t::resize()
+  would acquire before freeing any memory. */
+  bool got_latch;
+  {
+    buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(id.fold());
+    transactional_shared_lock_guard<page_hash_latch> g
+      {buf_pool.page_hash.lock_get(chain)};
+    if (!buf_pool.is_uncompressed(block) || id != block->page.id() ||
+        !block->page.frame || !block->page.in_file())
+      return nullptr;
+    got_latch= latch_mode == BTR_SEARCH_LEAF
+      ? block->page.lock.s_lock_try()
+      : block->page.lock.x_lock_try();
+  }
+
+  if (!got_latch)
+    return nullptr;
+
+  /* Any deletion or reorganization of the page, as well as the
+  eviction of the page, would have incremented modify_clock.
+  If block->index no longer points to our index, the adaptive hash
+  index has been dropped for the page. */
+  const auto state= block->page.state();
+  if (UNIV_UNLIKELY(state < buf_page_t::UNFIXED ||
+                    (state >= buf_page_t::READ_FIX &&
+                     state < buf_page_t::WRITE_FIX) ||
+                    modify_clock != block->modify_clock ||
+                    block->index != &index ||
+                    index.id != btr_page_get_index_id(block->page.frame)))
+  {
+    if (latch_mode == BTR_SEARCH_LEAF)
+      block->page.lock.s_unlock();
+    else
+      block->page.lock.x_unlock();
+    return nullptr;
+  }
+
+  block->page.fix();
+  block->page.set_accessed();
+  buf_page_make_young_if_needed(&block->page);
+  ++buf_pool.stat.n_page_gets;
+  mtr->memo_push(block, mtr_memo_type_t(latch_mode));
+  return block->page.frame + offset;
+}
+
 /** Tries to guess the right search position based on the hash search info
 of the index. Note that if mode is PAGE_CUR_LE, which is used in inserts,
 and the function returns TRUE, then cursor->up_match and cursor->low_match
@@ -1087,6 +1172,22 @@ btr_search_guess_on_hash(
 	auto part = btr_search_sys.get_part(*index);
 	const rec_t* rec;
 
+	if (!btr_search_enabled) {
+		goto fail;
+	}
+
+	if (const rec_t* crec = btr_search_guess_cached(
+		    *index, *part, fold, latch_mode, mtr)) {
+		btr_cur_position(index, const_cast<rec_t*>(crec),
+				 mtr->at_savepoint(mtr->get_savepoint() - 1),
+				 cursor);
+		if (btr_search_check_guess(cursor, false, tuple, mode)) {
+			btr_search_success(info);
+			return true;
+		}
+		mtr->release_last_page();
+	}
+
 	part->latch.rd_lock(SRW_LOCK_CALL);
 
 	if (!btr_search_enabled) {
@@ -1172,16 +1273,9 @@ btr_search_guess_on_hash(
 		goto fail;
 	}
 
-	if (info->n_hash_potential < BTR_SEARCH_BUILD_LIMIT + 5) {
-
-		info->n_hash_potential++;
-	}
-
-	info->last_hash_succ = TRUE;
-
-#ifdef UNIV_SEARCH_PERF_STAT
-	btr_search_n_succ++;
-#endif
+	part->guess_set(fold, block->page.id(), block, block->modify_clock,
+			uint16_t(page_offset(rec)));
+	btr_search_success(info);
 	return true;
 }
 
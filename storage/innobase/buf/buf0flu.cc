@@ -727,11 +727,105 @@ ATTRIBUTE_COLD void buf_pool_t::release_freed_page(buf_page_t *bpage) noexcept
   buf_LRU_free_page(bpage, true);
 }
 
+/** Capacity of flush_helpers.queue */
+static constexpr size_t FLUSH_HELPERS_QUEUE_SIZE= 256;
+
+/** Threads that help the page cleaner to checksum, encrypt, compress
+and submit the writes of a buf_pool.flush_list batch
+(innodb_flush_helper_threads). The batch itself is still collected by
+a single thread, which waits for the helpers before it ends. */
+static struct
+{
+  /** protects all members except n_threads */
+  mysql_mutex_t mutex;
+  /** signalled when pages are queued or the helpers should exit */
+  pthread_cond_t cond;
+  /** signalled when pending reaches 0 or a helper exits */
+  pthread_cond_t done;
+  /** pages waiting to be written */
+  struct
+  {
+    buf_page_t *bpage;
+    fil_space_t *space;
+    uint32_t state;
+  } queue[FLUSH_HELPERS_QUEUE_SIZE];
+  /** first queued element */
+  size_t head;
+  /** number of queued elements */
+  size_t n_queued;
+  /** number of queued or being written pages */
+  size_t pending;
+  /** number of running helper threads; modified under mutex, may be
+  read without it to check whether the helpers are in use */
+  Atomic_relaxed<uint> n_threads;
+  /** whether the helper threads should exit */
+  bool stop;
+} flush_helpers;
+
+/** Pass the write of a page to a flush helper thread.
+@param bpage   write-fixed page
+@param space   tablespace, referenced for the write
+@param s       bpage->state() before the page was write-fixed
+@return whether the page was queued */
+static bool buf_flush_helpers_add(buf_page_t *bpage, fil_space_t *space,
+                                  uint32_t s)
+{
+  if (!flush_helpers.n_threads)
+    return false;
+  mysql_mutex_lock(&flush_helpers.mutex);
+  const bool queued= !flush_helpers.stop &&
+    flush_helpers.n_queued < FLUSH_HELPERS_QUEUE_SIZE;
+  if (queued)
+  {
+    auto &e= flush_helpers.queue[(flush_helpers.head + flush_helpers.n_queued++)
+                                 % FLUSH_HELPERS_QUEUE_SIZE];
+    e.bpage= bpage;
+    e.space= space;
+    e.state= s;
+    flush_helpers.pending++;
+    pthread_cond_signal(&flush_helpers.cond);
+  }
+  mysql_mutex_unlock(&flush_helpers.mutex);
+  return queued;
+}
+
+/** Write out the first queued page.
+@return whether a page was written */
+static bool buf_flush_helpers_write_one()
+{
+  mysql_mutex_assert_owner(&flush_helpers.mutex);
+  if (!flush_helpers.n_queued)
+    return false;
+  const auto e= flush_helpers.queue[flush_helpers.head];
+  flush_helpers.head= (flush_helpers.head + 1) % FLUSH_HELPERS_QUEUE_SIZE;
+  flush_helpers.n_queued--;
+  mysql_mutex_unlock(&flush_helpers.mutex);
+  e.bpage->flush_write(false, e.space, e.state);
+  mysql_mutex_lock(&flush_helpers.mutex);
+  if (!--flush_helpers.pending)
+    pthread_cond_broadcast(&flush_helpers.done);
+  return true;
+}
+
+/** Wait for the flush helpers to submit all queued page writes, and help
+them meanwhile. buf_pool.mutex and buf_pool.flush_list_mutex must not be
+held, because completing writes may need them. */
+static void buf_flush_helpers_wait()
+{
+  mysql_mutex_assert_not_owner(&buf_pool.mutex);
+  mysql_mutex_assert_not_owner(&buf_pool.flush_list_mutex);
+  mysql_mutex_lock(&flush_helpers.mutex);
+  while (flush_helpers.pending)
+    if (!buf_flush_helpers_write_one())
+      my_cond_wait(&flush_helpers.done, &flush_helpers.mutex.m_mutex);
+  mysql_mutex_unlock(&flush_helpers.mutex);
+}
+
 /** Write a flushable page to a file or free a freeable block.
 @param evict       whether to evict the page on write completion
 @param space       tablespace
 @return whether a page write was initiated and buf_pool.mutex released */
-bool buf_page_t::flush(bool evict, fil_space_t *space)
+bool buf_page_t::flush(bool evict, fil_space_t *space, bool helper)
 {
   mysql_mutex_assert_not_owner(&buf_pool.flush_list_mutex);
   ut_ad(in_file());
@@ -761,10 +855,8 @@ bool buf_page_t::flush(bool evict, fil_space_t *space)
   buf_LRU_stat_inc_io();
   mysql_mutex_unlock(&buf_pool.mutex);
 
-  IORequest::Type type= IORequest::WRITE_ASYNC;
   if (UNIV_UNLIKELY(evict))
   {
-    type= IORequest::WRITE_LRU;
     mysql_mutex_lock(&buf_pool.flush_list_mutex);
     buf_pool.n_flush_inc();
     mysql_mutex_unlock(&buf_pool.flush_list_mutex);
@@ -778,10 +870,23 @@ bool buf_page_t::flush(bool evict, fil_space_t *space)
                         evict ? "LRU" : "flush_list",
                         id().space(), id().page_no()));
 
+  space->reacquire();
+
+  if (helper && !evict && buf_flush_helpers_add(this, space, s))
+    return true;
+
+  flush_write(evict, space, s);
+  return true;
+}
+
+void buf_page_t::flush_write(bool evict, fil_space_t *space, uint32_t s)
+{
+  ut_ad(is_write_fixed());
+  ut_ad(space->referenced());
+
+  IORequest::Type type= evict ? IORequest::WRITE_LRU : IORequest::WRITE_ASYNC;
   buf_block_t *block= reinterpret_cast<buf_block_t*>(this);
   page_t *write_frame= zip.data;
-
-  space->reacquire();
   size_t size;
 #if defined HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE || defined _WIN32
   size_t orig_size;
@@ -859,7 +964,6 @@ bool buf_page_t::flush(bool evict, fil_space_t *space)
   else
     buf_dblwr.add_to_batch(IORequest{this, slot, space->chain.start, type},
                            size);
-  return true;
 }
 
 /** Check whether a page can be flushed from the buf_pool.
@@ -1455,7 +1559,7 @@ static ulint buf_do_flush_list_batch(ulint max_n, lsn_t lsn)
       reacquire_mutex:
         mysql_mutex_lock(&buf_pool.mutex);
       }
-      else if (bpage->flush(false, space))
+      else if (bpage->flush(false, space, true))
       {
         ++count;
         goto reacquire_mutex;
@@ -1468,6 +1572,15 @@ static ulint buf_do_flush_list_batch(ulint max_n, lsn_t lsn)
 
   buf_pool.flush_hp.set(nullptr);
 
+  if (flush_helpers.n_threads)
+  {
+    mysql_mutex_unlock(&buf_pool.flush_list_mutex);
+    mysql_mutex_unlock(&buf_pool.mutex);
+    buf_flush_helpers_wait();
+    mysql_mutex_lock(&buf_pool.mutex);
+    mysql_mutex_lock(&buf_pool.flush_list_mutex);
+  }
+
   if (space)
     space->release();
 
@@ -2305,6 +2418,54 @@ static ulint page_cleaner_flush_pages_recommendation(ulint last_pages_in,
 	goto func_exit;
 }
 
+/** Flush helper thread, see flush_helpers */
+static void buf_flush_helper()
+{
+  my_thread_init();
+#ifdef UNIV_PFS_THREAD
+  pfs_register_thread(page_cleaner_thread_key);
+#endif /* UNIV_PFS_THREAD */
+
+  mysql_mutex_lock(&flush_helpers.mutex);
+  for (;;)
+  {
+    if (buf_flush_helpers_write_one())
+    {
+      MONITOR_ATOMIC_INC(MONITOR_FLUSH_HELPER_PAGES);
+    }
+    else if (flush_helpers.stop)
+      break;
+    else
+      my_cond_wait(&flush_helpers.cond, &flush_helpers.mutex.m_mutex);
+  }
+  flush_helpers.n_threads.fetch_sub(1);
+  pthread_cond_broadcast(&flush_helpers.done);
+  mysql_mutex_unlock(&flush_helpers.mutex);
+
+  my_thread_end();
+#ifdef UNIV_PFS_THREAD
+  pfs_delete_thread();
+#endif
+}
+
+/** Stop the flush helper threads once their queue is empty. */
+ATTRIBUTE_COLD static void buf_flush_helpers_stop()
+{
+  if (!srv_flush_helper_threads)
+    return;
+  mysql_mutex_lock(&flush_helpers.mutex);
+  flush_helpers.stop= true;
+  pthread_cond_broadcast(&flush_helpers.cond);
+  while (flush_helpers.n_threads)
+    my_cond_wait(&flush_helpers.done, &flush_helpers.mutex.m_mutex);
+  ut_ad(!flush_helpers.pending);
+  mysql_mutex_unlock(&flush_helpers.mutex);
+  /* With n_threads=0 nothing will access the mutex any more */
+  pthread_cond_destroy(&flush_helpers.done);
+  pthread_cond_destroy(&flush_helpers.cond);
+  mysql_mutex_destroy(&flush_helpers.mutex);
+}
+
 #if defined __aarch64__&&defined __GNUC__&&__GNUC__==4&&!defined __clang__
 /* Avoid GCC 4.8.5 internal compiler error "could not split insn".
 We would only need this for buf_flush_page_cleaner(),
@@ -2543,6 +2704,8 @@ static void buf_flush_page_cleaner()
     os_aio_wait_until_no_pending_writes(false);
   }
 
+  buf_flush_helpers_stop();
+
   mysql_mutex_lock(&buf_pool.flush_list_mutex);
   lsn_limit= buf_flush_sync_lsn;
   if (UNIV_UNLIKELY(lsn_limit != 0))
@@ -2572,6 +2735,19 @@ ATTRIBUTE_COLD void buf_flush_page_cleaner_init()
   buf_flush_async_lsn= 0;
   buf_flush_sync_lsn= 0;
   buf_page_cleaner_is_active= true;
+  if (srv_flush_helper_threads)
+  {
+    mysql_mutex_init(PSI_NOT_INSTRUMENTED, &flush_helpers.mutex, nullptr);
+    pthread_cond_init(&flush_helpers.cond, nullptr);
+    pthread_cond_init(&flush_helpers.done, nullptr);
+    flush_helpers.head= 0;
+    flush_helpers.n_queued= 0;
+    flush_helpers.pending= 0;
+    flush_helpers.stop= false;
+    flush_helpers.n_threads= srv_flush_helper_threads;
+    for (uint i= 0; i < srv_flush_helper_threads; i++)
+      std::thread(buf_flush_helper).detach();
+  }
   std::thread(buf_flush_page_cleaner).detach();
 }
 
@@ -672,6 +672,95 @@ ulint buf_read_ahead_linear(const page_id_t page_id, ulint zip_size)
   return count;
 }
 
+/** Issue read-ahead requests for the leaf pages of a B-tree scan.
+NOTE: the calling thread may own latches on pages: to avoid deadlocks this
+function must be written such that it cannot end up waiting for these
+latches!
+@param space_id  tablespace identifier
+@param pages     page numbers, in the order they will be accessed
+@param n         number of elements in pages[]
+@param zip_size  ROW_FORMAT=COMPRESSED page size, or 0
+@return number of page read requests issued */
+ulint buf_read_ahead_pages(uint32_t space_id, const uint32_t *pages, ulint n,
+                           ulint zip_size)
+{
+  if (srv_startup_is_before_trx_rollback_phase)
+    /* No read-ahead to avoid thread deadlocks */
+    return 0;
+
+  if (os_aio_pending_reads_approx() >
+      buf_pool.curr_size / BUF_READ_AHEAD_PEND_LIMIT)
+    return 0;
+
+  fil_space_t *space= fil_space_t::get(space_id);
+  if (!space)
+    return 0;
+
+  ulint count= 0;
+  buf_block_t *block= nullptr;
+  if (UNIV_LIKELY(!zip_size))
+  {
+  allocate_block:
+    if (UNIV_UNLIKELY(!(block= buf_read_acquire())))
+      goto func_exit;
+  }
+  else if (recv_recovery_is_on())
+  {
+    zip_size|= 1;
+    goto allocate_block;
+  }
+
+  for (ulint i= 0; i < n; i++)
+  {
+    if (space->is_stopping())
+      break;
+    if (pages[i] > space->last_page_number())
+      continue;
+    const page_id_t page_id{space_id, pages[i]};
+    buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(page_id.fold());
+    space->reacquire();
+    if (buf_read_page_low(page_id, zip_size, chain, space, block) ==
+        DB_SUCCESS)
+    {
+      count++;
+      ut_ad(!block);
+      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) &&
+          UNIV_UNLIKELY(!(block= buf_read_acquire())))
+        break;
+    }
+  }
+
+  if (count)
+  {
+    DBUG_PRINT("ib_buf", ("leaf read-ahead %zu pages from %s",
+                          count, space->chain.start->name));
+    mysql_mutex_lock(&buf_pool.mutex);
+    /* Read ahead is considered one I/O operation for the purpose of
+    LRU policy decision. */
+    buf_LRU_stat_inc_io();
+    buf_pool.stat.n_ra_pages_read+= count;
+    mysql_mutex_unlock(&buf_pool.mutex);
+  }
+
+func_exit:
+  space->release();
+  buf_read_release(block);
+  return count;
+}
+
+/** Determine if a page is being read into the buffer pool.
+@param page_id  page identifier
+@return whether a read of the page is in progress */
+TRANSACTIONAL_TARGET
+bool buf_read_in_progress(const page_id_t page_id)
+{
+  buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(page_id.fold());
+  transactional_shared_lock_guard<page_hash_latch> g
+    {buf_pool.page_hash.lock_get(chain)};
+  const buf_page_t *bpage= buf_pool.page_hash.get(page_id, chain);
+  return bpage && bpage->is_read_fixed();
+}
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
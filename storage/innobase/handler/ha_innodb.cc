@@ -18715,6 +18715,13 @@ static MYSQL_SYSVAR_BOOL(doublewrite, srv_use_doublewrite_buf,
   " Disable with --skip-innodb-doublewrite.",
   NULL, NULL, TRUE);
 
+static MYSQL_SYSVAR_BOOL(log_page_images, srv_log_page_images,
+  PLUGIN_VAR_OPCMDARG,
+  "Write a full page image to the redo log when a page is first modified"
+  " after having been written, so that the next write of the page"
+  " does not need the doublewrite buffer",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_BOOL(use_atomic_writes, srv_use_atomic_writes,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
   "Enable atomic writes, instead of using the doublewrite buffer, for files "
@@ -19045,6 +19052,12 @@ static MYSQL_SYSVAR_ULONG(flush_neighbors, srv_flush_neighbors,
   " when flushing a block",
   NULL, NULL, 1, 0, 2, 0);
 
+static MYSQL_SYSVAR_UINT(flush_helper_threads, srv_flush_helper_threads,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Number of threads that help the page cleaner to checksum, encrypt,"
+  " compress and submit page writes (0=the page cleaner does it alone)",
+  NULL, NULL, 0, 0, 64, 0);
+
 static MYSQL_SYSVAR_BOOL(deadlock_detect, innodb_deadlock_detect,
   PLUGIN_VAR_NOCMDARG,
   "Enable/disable InnoDB deadlock detector (default ON)."
@@ -19137,6 +19150,13 @@ static MYSQL_SYSVAR_ULONG(sort_buffer_size, srv_sort_buf_size,
   "Memory buffer size for index creation",
   NULL, NULL, 1048576, 65536, 64<<20, 0);
 
+static MYSQL_SYSVAR_ULONG(ddl_threads, srv_ddl_threads,
+  PLUGIN_VAR_RQCMDARG,
+  "Number of threads for merge-sorting the secondary indexes"
+  " created by ALTER TABLE, or the indexes loaded by a bulk insert"
+  " into an empty table; 1 sorts them one at a time",
+  NULL, NULL, 1, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONGLONG(online_alter_log_max_size, srv_online_max_size,
   PLUGIN_VAR_RQCMDARG,
   "Maximum modification log file size for online index creation",
@@ -19390,6 +19410,12 @@ static MYSQL_SYSVAR_ULONG(read_ahead_threshold, srv_read_ahead_threshold,
   " trigger a readahead.",
   NULL, NULL, 56, 0, 64, 0);
 
+static MYSQL_SYSVAR_ULONG(read_ahead_leaf_pages, srv_read_ahead_leaf_pages,
+  PLUGIN_VAR_RQCMDARG,
+  "Maximum number of B-tree leaf pages to read ahead of a forward index"
+  " scan, found via the node pointers of the parent pages; 0 disables",
+  NULL, NULL, 0, 0, BTR_READ_AHEAD_MAX, 0);
+
 static MYSQL_SYSVAR_STR(monitor_enable, innobase_enable_monitor_counter,
   PLUGIN_VAR_RQCMDARG,
   "Turn on a monitor counter",
@@ -19611,12 +19637,14 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(lru_scan_depth),
   MYSQL_SYSVAR(lru_flush_size),
   MYSQL_SYSVAR(flush_neighbors),
+  MYSQL_SYSVAR(flush_helper_threads),
   MYSQL_SYSVAR(checksum_algorithm),
   MYSQL_SYSVAR(compression_level),
   MYSQL_SYSVAR(data_file_path),
   MYSQL_SYSVAR(temp_data_file_path),
   MYSQL_SYSVAR(data_home_dir),
   MYSQL_SYSVAR(doublewrite),
+  MYSQL_SYSVAR(log_page_images),
   MYSQL_SYSVAR(stats_include_delete_marked),
   MYSQL_SYSVAR(use_atomic_writes),
   MYSQL_SYSVAR(fast_shutdown),
@@ -19683,6 +19711,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(status_file),
   MYSQL_SYSVAR(strict_mode),
   MYSQL_SYSVAR(sort_buffer_size),
+  MYSQL_SYSVAR(ddl_threads),
   MYSQL_SYSVAR(online_alter_log_max_size),
   MYSQL_SYSVAR(sync_spin_loops),
   MYSQL_SYSVAR(spin_wait_delay),
@@ -19696,6 +19725,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
 #endif /* HAVE_LIBNUMA */
   MYSQL_SYSVAR(random_read_ahead),
   MYSQL_SYSVAR(read_ahead_threshold),
+  MYSQL_SYSVAR(read_ahead_leaf_pages),
   MYSQL_SYSVAR(read_only),
   MYSQL_SYSVAR(read_only_compressed),
   MYSQL_SYSVAR(instant_alter_column_allowed),
@@ -45,6 +45,9 @@ of a scroll cursor easier */
 	BTR_PCUR_AFTER_LAST_IN_TREE	= 5	/* in an empty tree */
 };
 
+/** Maximum value of innodb_read_ahead_leaf_pages */
+constexpr ulint BTR_READ_AHEAD_MAX= 256;
+
 /**************************************************************//**
 Resets a persistent cursor object, freeing ::old_rec_buf if it is
 allocated and resetting the other members to their initial values. */
@@ -347,6 +350,18 @@ struct btr_pcur_t
   byte *old_rec_buf= nullptr;
   /** old_rec_buf size if old_rec_buf is not NULL */
   ulint buf_size= 0;
+  /** leaf page read-ahead state of btr_pcur_move_to_next_page() */
+  struct
+  {
+    /** the leaf page that the cursor last moved to, or FIL_NULL */
+    uint32_t leaf= FIL_NULL;
+    /** number of consecutive moves to the next leaf page */
+    uint32_t n_moves= 0;
+    /** number of submitted leaf pages that the scan has not reached */
+    uint32_t ahead= 0;
+    /** current read-ahead depth, at most innodb_read_ahead_leaf_pages */
+    uint32_t depth= 0;
+  } read_ahead;
 
   /** Return the index of this persistent cursor */
   dict_index_t *index() const { return(btr_cur.index()); }
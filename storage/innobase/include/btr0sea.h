@@ -247,6 +247,79 @@ struct btr_search_sys_t
     /** memory heap for table */
     mem_heap_t *heap;
 
+    /** A cached result of a successful lookup in table. Entries are
+    read without holding latch, and they are validated in the same way
+    as btr_pcur_t::restore_position() validates a stored cursor:
+    by the page identifier and buf_block_t::modify_clock. */
+    struct guess
+    {
+      /** sequence number; odd while the entry is being written */
+      std::atomic<uint32_t> version;
+      /** page_offset() of the record */
+      Atomic_relaxed<uint16_t> offset;
+      /** dtuple_fold() of the search key */
+      Atomic_relaxed<ulint> fold;
+      /** page_id_t::raw() of the page */
+      Atomic_relaxed<uint64_t> page_id;
+      /** the block that contained the page (possibly no longer) */
+      Atomic_relaxed<buf_block_t*> block;
+      /** buf_block_t::modify_clock at the time of the lookup */
+      Atomic_relaxed<uint64_t> modify_clock;
+    };
+
+    /** number of entries in guesses[] */
+    static constexpr size_t N_GUESSES= 256;
+    /** direct-mapped cache of recent lookups, indexed by fold */
+    guess guesses[N_GUESSES];
+
+    /** Look up a cached guess.
+    @param fold          dtuple_fold() of the search key
+    @param id            page identifier
+    @param block         the block that contained the page
+    @param modify_clock  buf_block_t::modify_clock
+    @param offset        page_offset() of the record
+    @return whether a consistent entry for fold was found */
+    bool guess_get(ulint fold, page_id_t &id, buf_block_t *&block,
+                   uint64_t &modify_clock, uint16_t &offset) const
+    {
+      const guess &g= guesses[fold % N_GUESSES];
+      const uint32_t v= g.version.load(std::memory_order_acquire);
+      if (v & 1 || g.fold != fold)
+        return false;
+      id= page_id_t{g.page_id};
+      block= g.block;
+      modify_clock= g.modify_clock;
+      offset= g.offset;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return v == g.version.load(std::memory_order_relaxed) && block;
+    }
+
+    /** Cache the result of a successful lookup.
+    @param fold          dtuple_fold() of the search key
+    @param id            page identifier
+    @param block         the block that contains the page
+    @param modify_clock  buf_block_t::modify_clock
+    @param offset        page_offset() of the record */
+    void guess_set(ulint fold, page_id_t id, buf_block_t *block,
+                   uint64_t modify_clock, uint16_t offset)
+    {
+      guess &g= guesses[fold % N_GUESSES];
+      uint32_t v= g.version.load(std::memory_order_relaxed);
+      /* If another thread is writing the entry, let it win. */
+      if (v & 1 ||
+          !g.version.compare_exchange_strong(v, v + 1,
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed))
+        return;
+      std::atomic_thread_fence(std::memory_order_release);
+      g.fold= fold;
+      g.page_id= id.raw();
+      g.block= block;
+      g.modify_clock= modify_clock;
+      g.offset= offset;
+      g.version.store(v + 2, std::memory_order_release);
+    }
+
 #ifdef _MSC_VER
 #pragma warning(push)
 // nonstandard extension - zero sized array, if perfschema is not compiled
@@ -254,7 +327,7 @@ struct btr_search_sys_t
 #endif
 
     char pad[(CPU_LEVEL1_DCACHE_LINESIZE - sizeof latch -
-              sizeof table - sizeof heap) &
+              sizeof table - sizeof heap - sizeof guesses) &
              (CPU_LEVEL1_DCACHE_LINESIZE - 1)];
 
 #ifdef _MSC_VER
@@ -751,8 +751,17 @@ class buf_page_t
   /** Write a flushable page to a file or free a freeable block.
   @param evict       whether to evict the page on write completion
   @param space       tablespace
+  @param helper      whether the write may be passed to a page cleaner
+                     helper thread (innodb_flush_helper_threads)
   @return whether a page write was initiated and buf_pool.mutex released */
-  bool flush(bool evict, fil_space_t *space);
+  bool flush(bool evict, fil_space_t *space, bool helper= false);
+
+  /** Checksum, encrypt or compress and write out a page that flush()
+  has write-fixed.
+  @param evict       whether to evict the page on write completion
+  @param space       tablespace, referenced for the write
+  @param s           state() before the page was write-fixed */
+  void flush_write(bool evict, fil_space_t *space, uint32_t s);
 
   /** Notify that a page in a temporary tablespace has been modified. */
   void set_temp_modified()
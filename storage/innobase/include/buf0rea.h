@@ -91,6 +91,23 @@ latches!
 @return number of page read requests issued */
 ulint buf_read_ahead_linear(const page_id_t page_id, ulint zip_size);
 
+/** Issue read-ahead requests for the leaf pages of a B-tree scan.
+NOTE: the calling thread may own latches on pages: to avoid deadlocks this
+function must be written such that it cannot end up waiting for these
+latches!
+@param space_id  tablespace identifier
+@param pages     page numbers, in the order they will be accessed
+@param n         number of elements in pages[]
+@param zip_size  ROW_FORMAT=COMPRESSED page size, or 0
+@return number of page read requests issued */
+ulint buf_read_ahead_pages(uint32_t space_id, const uint32_t *pages, ulint n,
+                           ulint zip_size);
+
+/** Determine if a page is being read into the buffer pool.
+@param page_id  page identifier
+@return whether a read of the page is in progress */
+bool buf_read_in_progress(const page_id_t page_id);
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
@@ -207,6 +207,9 @@ typedef srw_lock log_rwlock_t;
 private:
   /** Last written LSN */
   lsn_t write_lsn;
+  /** the LSN corresponding to buf[0] unless is_pmem();
+  protected by latch.wr_lock() */
+  lsn_t buf_lsn;
 public:
   /** log record buffer, written to by mtr_t::commit() */
   byte *buf;
@@ -234,7 +237,7 @@ typedef srw_lock log_rwlock_t;
   /** Buffer for writing to resize_log; @see flush_buf */
   byte *resize_flush_buf;
 
-  /** spin lock protecting lsn, buf_free in append_prepare() */
+  /** spin lock protecting lsn, buf_free in append_prepare() if is_pmem() */
   alignas(CPU_LEVEL1_DCACHE_LINESIZE) pthread_mutex_t lsn_lock;
   void init_lsn_lock() { pthread_mutex_init(&lsn_lock, LSN_LOCK_ATTR); }
   void lock_lsn() { pthread_mutex_lock(&lsn_lock); }
@@ -242,12 +245,16 @@ typedef srw_lock log_rwlock_t;
   void destroy_lsn_lock() { pthread_mutex_destroy(&lsn_lock); }
 
 public:
-  /** first free offset within buf use; protected by lsn_lock */
+  /** flag in buf_free that makes append_prepare() wait for write_buf() */
+  static constexpr size_t BUF_FREE_BACKOFF{~(~size_t{0} >> 1)};
+  /** first free offset within buf use, possibly with BUF_FREE_BACKOFF;
+  protected by lsn_lock if is_pmem(), else reserved by fetch_add()
+  in append_prepare() while holding latch */
   Atomic_relaxed<size_t> buf_free;
-  /** number of write requests (to buf); protected by exclusive lsn_lock */
-  ulint write_to_buf;
-  /** number of waits in append_prepare(); protected by lsn_lock */
-  ulint waits;
+  /** number of write requests (to buf) */
+  Atomic_counter<ulint> write_to_buf;
+  /** number of waits in append_prepare() */
+  Atomic_counter<ulint> waits;
   /** recommended maximum size of buf, after which the buffer is flushed */
   size_t max_buf_free;
 
@@ -383,6 +390,14 @@ typedef srw_lock log_rwlock_t;
   lsn_t get_lsn(std::memory_order order= std::memory_order_relaxed) const
   { return lsn.load(order); }
 
+  /** Set buf_free, with latch.wr_lock() or during startup.
+  @param b  the offset of get_lsn() in buf */
+  void set_buf_free(size_t b) noexcept
+  {
+    buf_free= b;
+    buf_lsn= get_lsn() - b;
+  }
+
   lsn_t get_flushed_lsn(std::memory_order order= std::memory_order_acquire)
     const noexcept
   { return flushed_to_disk_lsn.load(order); }
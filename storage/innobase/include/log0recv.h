@@ -211,6 +211,10 @@ struct recv_sys_t
   lsn_t file_checkpoint;
   /** the time when progress was last reported */
   time_t progress_time;
+  /** pages.size() at the previous report_progress() */
+  size_t progress_pages;
+  /** progress_time at the previous report_progress() */
+  time_t progress_pages_time;
 
   using map = std::map<const page_id_t, page_recv_t,
                        std::less<const page_id_t>,
@@ -366,7 +370,7 @@ struct recv_sys_t
   ATTRIBUTE_COLD void rewind(source &l, source &begin) noexcept;
 
   /** Report progress in terms of LSN or pages remaining */
-  ATTRIBUTE_COLD void report_progress() const;
+  ATTRIBUTE_COLD void report_progress();
 public:
   /** Parse and register one log_t::FORMAT_10_8 mini-transaction,
   handling log_sys.is_pmem() buffer wrap-around.
@@ -642,6 +642,11 @@ struct mtr_t {
   /** Note that log_sys.latch is no longer being held exclusively. */
   void flag_wr_unlock() noexcept { ut_ad(m_latch_ex); m_latch_ex= false; }
 
+  /** Maximum number of pages whose images a mini-transaction will log
+  (innodb_log_page_images). The rest will keep using the doublewrite
+  buffer. log_t::set_capacity() reserves log space for these images. */
+  static constexpr unsigned PAGE_IMAGES_MAX= 8;
+
   /** type of page flushing is needed during commit() */
   enum page_flush_ahead
   {
@@ -658,6 +663,16 @@ struct mtr_t {
   void process_freed_pages();
   /** Release modified pages when no log was written. */
   void release_unlogged();
+  /** Buffer-fix and X-latch the pages that this mini-transaction
+  is making dirty, for which log_page_images() should be invoked.
+  @param images  pages that will need a full image in the log */
+  void collect_page_images(small_vector<buf_block_t*, PAGE_IMAGES_MAX>
+                           &images) const;
+  /** Write the full images of pages in a separate mini-transaction
+  (innodb_log_page_images), and release the pages.
+  @param images  pages from collect_page_images() */
+  void log_page_images(const small_vector<buf_block_t*, PAGE_IMAGES_MAX>
+                       &images) const;
 
   /** Log a write of a byte string to a page.
   @param block   buffer page
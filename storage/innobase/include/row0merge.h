@@ -441,6 +441,31 @@ class row_merge_bulk_t
   ut_new_pfx_t m_crypt_pfx;
   /** Block for encryption */
   row_merge_block_t *m_crypt_block= nullptr;
+
+  /** Write the merge buffer to the tmp file for the given
+  index number.
+  @param index_no       buffer to be written for the index
+  @param block          block for IO operation
+  @param crypt_block    block for encryption, or nullptr */
+  dberr_t write_to_tmp_file(ulint index_no, row_merge_block_t *block,
+                            row_merge_block_t *crypt_block);
+
+  /** Do bulk insert operation into the index tree from
+  buffer or merge file if exists
+  @param index_no       index to be inserted
+  @param trx            bulk transaction
+  @param block          block for IO operation
+  @param crypt_block    block for encryption, or nullptr
+  @param tmpfd          temporary file for merge sort */
+  dberr_t write_to_index(ulint index_no, trx_t *trx,
+                         row_merge_block_t *block,
+                         row_merge_block_t *crypt_block,
+                         pfs_os_file_t *tmpfd);
+
+  /** Load indexes until all have been claimed by write_to_table().
+  Every task allocates its own buffers and temporary file.
+  @param arg  row_merge_bulk_ctx_t */
+  static void write_task(void *arg);
 public:
   /** Constructor.
   Create all merge files, merge buffer for all the table indexes
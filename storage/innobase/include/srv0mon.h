@@ -210,6 +210,7 @@ enum monitor_id_t {
 	MONITOR_FLUSH_BACKGROUND_TOTAL_PAGE,
 	MONITOR_FLUSH_BACKGROUND_COUNT,
 	MONITOR_FLUSH_BACKGROUND_PAGES,
+	MONITOR_FLUSH_HELPER_PAGES,
 	MONITOR_LRU_BATCH_SCANNED,
 	MONITOR_LRU_BATCH_SCANNED_NUM_CALL,
 	MONITOR_LRU_BATCH_SCANNED_PER_CALL,
@@ -279,6 +280,7 @@ enum monitor_id_t {
 	MONITOR_N_UPD_EXIST_EXTERN,
 	MONITOR_PURGE_INVOKED,
 	MONITOR_PURGE_N_PAGE_HANDLED,
+	MONITOR_PURGE_N_THREADS,
 	MONITOR_DML_PURGE_DELAY,
 	MONITOR_PURGE_STOP_COUNT,
 	MONITOR_PURGE_RESUME_COUNT,
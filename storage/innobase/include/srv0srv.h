@@ -174,6 +174,9 @@ extern my_bool	srv_file_per_table;
 
 /** Sort buffer size in index creation */
 extern ulong	srv_sort_buf_size;
+/** Number of threads for merge-sorting secondary indexes in
+row_merge_build_indexes() */
+extern ulong	srv_ddl_threads;
 /** Maximum modification log file size for online index creation */
 extern unsigned long long	srv_online_max_size;
 
@@ -257,7 +260,11 @@ extern ulint	srv_lock_table_size;
 extern ulong	srv_checksum_algorithm;
 extern my_bool	srv_random_read_ahead;
 extern ulong	srv_read_ahead_threshold;
+/** innodb_read_ahead_leaf_pages */
+extern ulong	srv_read_ahead_leaf_pages;
 extern uint	srv_n_read_io_threads;
+/** innodb_flush_helper_threads */
+extern uint	srv_flush_helper_threads;
 extern uint	srv_n_write_io_threads;
 
 /* Number of IO operations per second the server can do */
@@ -301,6 +308,9 @@ extern unsigned long long	srv_stats_modified_counter;
 extern my_bool			srv_stats_sample_traditional;
 
 extern my_bool	srv_use_doublewrite_buf;
+/** innodb_log_page_images: whether to write a full page image to the log
+when a page is first modified after having been written */
+extern my_bool	srv_log_page_images;
 extern ulong	srv_checksum_algorithm;
 
 extern my_bool	srv_force_primary_key;
@@ -3969,44 +3969,82 @@ void lock_release(trx_t *trx)
   ulint count;
 
   for (count= 5; count--; )
+  {
+    if (DBUG_IF("lock_release_no_try"))
+      break;
     if (lock_release_try(trx))
       goto released;
+  }
 
-  /* Fall back to acquiring lock_sys.latch in exclusive mode */
+  /* Fall back to waiting for each lock_sys.rec_hash latch or
+  dict_table_t::lock_mutex, in the same order as everywhere else:
+  before acquiring trx->mutex. This only blocks the threads that
+  access the same hash table cells or tables as we do. */
 restart:
   count= 1000;
-  /* There is probably no point to try lock elision here;
-  in lock_release_try() it is different. */
-  lock_sys.wr_lock(SRW_LOCK_CALL);
-  trx->mutex_lock();
+  lock_sys.rd_lock(SRW_LOCK_CALL);
 
-  while (lock_t *lock= UT_LIST_GET_LAST(trx->lock.trx_locks))
+  /* Our transaction has been committed, so it will not acquire any new
+  locks. But other threads may still discard or move its record locks
+  while holding the lock_sys.rec_hash latch of the page and trx->mutex:
+  see lock_rec_discard() and the lock inheritance on page reorganize,
+  split or merge. Therefore, the lock that we picked must be validated
+  once we hold the latch and trx->mutex. */
+  for (;;)
   {
+    trx->mutex_lock();
+    lock_t *lock= UT_LIST_GET_LAST(trx->lock.trx_locks);
+    if (!lock)
+    {
+      trx->mutex_unlock();
+      break;
+    }
     ut_ad(lock->trx == trx);
-    if (!lock->is_table())
+    const unsigned type_mode= lock->type_mode;
+    if (!(type_mode & LOCK_TABLE))
     {
       ut_ad(!lock->index->table->is_temporary());
       ut_ad(lock->mode() != LOCK_X ||
             lock->index->table->id >= DICT_HDR_FIRST_ID ||
             trx->dict_operation || trx->was_dict_operation);
-      lock_rec_dequeue_from_page(lock, false);
+      const page_id_t id{lock->un_member.rec_lock.page_id};
+      trx->mutex_unlock();
+      DEBUG_SYNC_C("lock_release_rec_picked");
+      auto &lock_hash= lock_sys.hash_get(type_mode);
+      auto latch= lock_sys_t::hash_table::latch(lock_hash.cell_get(id.fold()));
+      latch->acquire();
+      trx->mutex_lock();
+      /* If the lock was discarded or moved meanwhile, pick again */
+      if (lock == UT_LIST_GET_LAST(trx->lock.trx_locks) &&
+          !lock->is_table() &&
+          &lock_sys.hash_get(lock->type_mode) == &lock_hash &&
+          lock->un_member.rec_lock.page_id == id)
+        lock_rec_dequeue_from_page(lock, false);
+      trx->mutex_unlock();
+      latch->release();
     }
     else
     {
-      ut_d(dict_table_t *table= lock->un_member.tab_lock.table);
+      /* Table locks are only released by their owner */
+      dict_table_t *table= lock->un_member.tab_lock.table;
       ut_ad(!table->is_temporary());
       ut_ad(table->id >= DICT_HDR_FIRST_ID ||
             (lock->mode() != LOCK_IX && lock->mode() != LOCK_X) ||
             trx->dict_operation || trx->was_dict_operation);
+      trx->mutex_unlock();
+      table->lock_mutex_lock();
+      trx->mutex_lock();
+      ut_ad(lock == UT_LIST_GET_LAST(trx->lock.trx_locks));
       lock_table_dequeue(lock, false);
+      trx->mutex_unlock();
+      table->lock_mutex_unlock();
     }
 
     if (!--count)
       break;
   }
 
-  lock_sys.wr_unlock();
-  trx->mutex_unlock();
+  lock_sys.rd_unlock();
   if (!count)
     goto restart;
 
@@ -79,13 +79,15 @@ void log_t::set_capacity()
 	ut_ad(log_sys.latch.is_write_locked());
 #endif
 	/* Margin for the free space in the smallest log, before a new query
-	step which modifies the database, is started */
+	step which modifies the database, is started. This includes the
+	page images that the step may log (innodb_log_page_images). */
 
 	lsn_t smallest_capacity = srv_log_file_size - log_t::START_OFFSET;
 	/* Add extra safety */
 	smallest_capacity -= smallest_capacity / 10;
 
-	lsn_t margin = smallest_capacity - (48 << srv_page_size_shift);
+	lsn_t margin = smallest_capacity
+		- ((48 + mtr_t::PAGE_IMAGES_MAX) << srv_page_size_shift);
 	margin -= margin / 10;	/* Add still some extra safety */
 
 	log_sys.log_capacity = smallest_capacity;
@@ -132,7 +134,7 @@ void log_t::create()
   next_checkpoint_lsn= 0;
   checkpoint_pending= false;
 
-  buf_free= 0;
+  set_buf_free(0);
 
   ut_ad(is_initialised());
 }
@@ -293,12 +295,12 @@ void log_t::create(lsn_t lsn) noexcept
   {
     mprotect(buf, size_t(file_size), PROT_READ | PROT_WRITE);
     memset_aligned<4096>(buf, 0, 4096);
-    buf_free= START_OFFSET;
+    set_buf_free(START_OFFSET);
   }
   else
 #endif
   {
-    buf_free= 0;
+    set_buf_free(0);
     memset_aligned<4096>(flush_buf, 0, buf_size);
     memset_aligned<4096>(buf, 0, buf_size);
   }
@@ -510,7 +512,8 @@ log_t::resize_start_status log_t::resize_start(os_offset_t size) noexcept
         }
         else
         {
-          memcpy_aligned<16>(resize_buf, buf, (buf_free + 15) & ~15);
+          memcpy_aligned<16>(resize_buf, buf,
+                             ((buf_free & ~BUF_FREE_BACKOFF) + 15) & ~15);
           start_lsn= first_lsn +
             (~lsn_t{get_block_size() - 1} & (write_lsn - first_lsn));
         }
@@ -825,10 +828,13 @@ template<bool release_latch> inline lsn_t log_t::write_buf() noexcept
     DBUG_PRINT("ib_log", ("write " LSN_PF " to " LSN_PF " at " LSN_PF,
                           write_lsn, lsn, offset));
     const byte *write_buf{buf};
-    size_t length{buf_free};
+    /* Any append_prepare() that overran buf has withdrawn its
+    reservation before releasing latch. Reset BUF_FREE_BACKOFF. */
+    size_t length{buf_free & ~BUF_FREE_BACKOFF};
     ut_ad(length >= (calc_lsn_offset(write_lsn) & block_size_1));
+    ut_ad(lsn == buf_lsn + length);
     const size_t new_buf_free{length & block_size_1};
-    buf_free= new_buf_free;
+    set_buf_free(new_buf_free);
     ut_ad(new_buf_free == ((lsn - first_lsn) & block_size_1));
 
     if (new_buf_free)
@@ -1314,6 +1314,8 @@ void recv_sys_t::create()
 	file_checkpoint = 0;
 
 	progress_time = time(NULL);
+	progress_pages = 0;
+	progress_pages_time = progress_time;
 	ut_ad(pages.empty());
 	pages_it = pages.end();
 	recv_max_page_lsn = 0;
@@ -3386,11 +3388,27 @@ bool recv_sys_t::report(time_t time)
 }
 
 ATTRIBUTE_COLD
-void recv_sys_t::report_progress() const
+void recv_sys_t::report_progress()
 {
   mysql_mutex_assert_owner(&mutex);
   const size_t n{pages.size()};
-  if (recv_sys.scanned_lsn == recv_sys.lsn)
+  /* While applying, pages are removed as they are recovered. */
+  size_t rate= 0;
+  if (apply_log_recs && progress_pages > n &&
+      progress_time > progress_pages_time)
+    rate= (progress_pages - n) / size_t(progress_time - progress_pages_time);
+  progress_pages= n;
+  progress_pages_time= progress_time;
+
+  if (rate)
+  {
+    sql_print_information("InnoDB: To recover: %zu pages at %zu pages/s",
+                          n, rate);
+    service_manager_extend_timeout(INNODB_EXTEND_TIMEOUT_INTERVAL,
+                                   "To recover: %zu pages at %zu pages/s",
+                                   n, rate);
+  }
+  else if (recv_sys.scanned_lsn == recv_sys.lsn)
   {
     sql_print_information("InnoDB: To recover: %zu pages", n);
     service_manager_extend_timeout(INNODB_EXTEND_TIMEOUT_INTERVAL,
@@ -4532,7 +4550,7 @@ dberr_t recv_recovery_from_checkpoint_start()
 				 PROT_READ | PROT_WRITE);
 #endif
 		}
-		log_sys.buf_free = recv_sys.offset;
+		log_sys.set_buf_free(recv_sys.offset);
 		if (recv_needed_recovery
 	            && srv_operation <= SRV_OPERATION_EXPORT_RESTORED) {
 			/* Write a FILE_CHECKPOINT marker as the first thing,
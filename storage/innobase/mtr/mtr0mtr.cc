@@ -324,6 +324,9 @@ void mtr_t::commit()
     }
 
     ut_ad(!srv_read_only_mode);
+    small_vector<buf_block_t*, PAGE_IMAGES_MAX> images;
+    if (m_made_dirty && srv_log_page_images)
+      collect_page_images(images);
     std::pair<lsn_t,page_flush_ahead> lsns{do_write()};
     process_freed_pages();
     size_t modified= 0;
@@ -443,6 +446,9 @@ void mtr_t::commit()
       m_memo.clear();
     }
 
+    if (!images.empty())
+      log_page_images(images);
+
     mariadb_increment_pages_updated(modified);
 
     if (UNIV_UNLIKELY(lsns.second != PAGE_FLUSH_NO))
@@ -874,7 +880,9 @@ ATTRIBUTE_COLD static void log_overwrite_warning(lsn_t lsn)
 ATTRIBUTE_COLD void log_t::append_prepare_wait(bool ex) noexcept
 {
   log_sys.waits++;
-  log_sys.unlock_lsn();
+  const bool pmem{log_sys.is_pmem()};
+  if (pmem)
+    log_sys.unlock_lsn();
 
   if (ex)
     log_sys.latch.wr_unlock();
@@ -882,14 +890,15 @@ ATTRIBUTE_COLD void log_t::append_prepare_wait(bool ex) noexcept
     log_sys.latch.rd_unlock();
 
   DEBUG_SYNC_C("log_buf_size_exceeded");
-  log_buffer_flush_to_disk(log_sys.is_pmem());
+  log_buffer_flush_to_disk(pmem);
 
   if (ex)
     log_sys.latch.wr_lock(SRW_LOCK_CALL);
   else
     log_sys.latch.rd_lock(SRW_LOCK_CALL);
 
-  log_sys.lock_lsn();
+  if (pmem)
+    log_sys.lock_lsn();
 }
 
 /** Reserve space in the log buffer for appending data.
@@ -910,28 +919,57 @@ std::pair<lsn_t,byte*> log_t::append_prepare(size_t size, bool ex) noexcept
   ut_ad(pmem == is_pmem());
   const lsn_t checkpoint_margin{last_checkpoint_lsn + log_capacity - size};
   const size_t avail{(pmem ? size_t(capacity()) : buf_size) - size};
-  lock_lsn();
   write_to_buf++;
+  lsn_t l;
+  size_t b;
 
-  for (ut_d(int count= 50);
-       UNIV_UNLIKELY((pmem
-                      ? size_t(get_lsn() -
-                               get_flushed_lsn(std::memory_order_relaxed))
-                      : size_t{buf_free}) > avail); )
+  if (!pmem)
   {
-    append_prepare_wait(ex);
-    ut_ad(count--);
+    /* Reserve the space without lsn_lock. Because write_buf() requires
+    latch.wr_lock(), the offset and buf_lsn cannot change under us.
+    If we would overrun buf, set BUF_FREE_BACKOFF so that all subsequent
+    reservations will fail as well, and withdraw our own reservation
+    before waiting. Thus, buf_free will be exact for write_buf(). */
+    for (ut_d(int count= 50);
+         UNIV_UNLIKELY((b= buf_free.fetch_add(size)) > avail); )
+    {
+      buf_free.fetch_or(BUF_FREE_BACKOFF);
+      buf_free.fetch_sub(size);
+      append_prepare_wait(ex);
+      ut_ad(count--);
+    }
+
+    l= buf_lsn + b;
+    /* Concurrent reservations may complete in any order, but the
+    end LSN that is published by get_lsn() must never go backwards. */
+    for (lsn_t old{lsn.load(std::memory_order_relaxed)}, end{l + size};
+         old < end &&
+           !lsn.compare_exchange_weak(old, end, std::memory_order_relaxed); )
+    {}
   }
+  else
+  {
+    lock_lsn();
 
-  const lsn_t l{lsn.load(std::memory_order_relaxed)};
-  lsn.store(l + size, std::memory_order_relaxed);
-  const size_t b{buf_free};
-  size_t new_buf_free{b};
-  new_buf_free+= size;
-  if (pmem && new_buf_free >= file_size)
-    new_buf_free-= size_t(capacity());
-  buf_free= new_buf_free;
-  unlock_lsn();
+    for (ut_d(int count= 50);
+         UNIV_UNLIKELY(size_t(get_lsn() -
+                              get_flushed_lsn(std::memory_order_relaxed)) >
+                       avail); )
+    {
+      append_prepare_wait(ex);
+      ut_ad(count--);
+    }
+
+    l= lsn.load(std::memory_order_relaxed);
+    lsn.store(l + size, std::memory_order_relaxed);
+    b= buf_free;
+    size_t new_buf_free{b};
+    new_buf_free+= size;
+    if (new_buf_free >= file_size)
+      new_buf_free-= size_t(capacity());
+    buf_free= new_buf_free;
+    unlock_lsn();
+  }
 
   if (UNIV_UNLIKELY(l > checkpoint_margin) ||
       (!pmem && b >= max_buf_free))
@@ -1571,6 +1609,55 @@ void mtr_t::set_modified(const buf_block_t &block)
   ut_ad(!block.page.in_LRU_list);
 }
 
+void mtr_t::collect_page_images
+  (small_vector<buf_block_t*, PAGE_IMAGES_MAX> &images) const
+{
+  ut_ad(is_logged());
+  for (const mtr_memo_slot_t &slot : m_memo)
+  {
+    /* Pages that are modified under an SX-latch (such as allocation
+    bitmap pages) and ROW_FORMAT=COMPRESSED pages, whose log records
+    refer to the compressed page, will keep using the doublewrite
+    buffer. So will pages that were (re)initialized in this
+    mini-transaction, because recovery will not read them anyway. */
+    if (slot.type != MTR_MEMO_PAGE_X_MODIFY)
+      continue;
+    buf_block_t *b= static_cast<buf_block_t*>(slot.object);
+    if (b->page.oldest_modification() > 1 || b->page.zip.data ||
+        !b->page.id().page_no())
+      continue;
+    const auto s= b->page.state();
+    if (s < buf_page_t::UNFIXED || s >= buf_page_t::REINIT)
+      continue;
+    b->page.fix();
+    b->page.lock.x_lock_recursive();
+    images.emplace_back(static_cast<buf_block_t*>(slot.object));
+    if (images.size() == PAGE_IMAGES_MAX)
+      break;
+  }
+}
+
+void mtr_t::log_page_images
+  (const small_vector<buf_block_t*, PAGE_IMAGES_MAX> &images) const
+{
+  /* The images must be written after our log records, so that
+  recovery will discard anything before the INIT_PAGE record and
+  never read the pages, which may have been written partially. */
+  mtr_t mtr;
+  mtr.start();
+  if (m_user_space)
+    mtr.set_named_space(m_user_space);
+  for (buf_block_t *b : images)
+  {
+    mtr.memo_push(b, MTR_MEMO_PAGE_X_FIX);
+    /* This will write INIT_PAGE and set the buf_page_t::REINIT state,
+    so that buf_page_t::flush() will not use the doublewrite buffer. */
+    mtr.init(b);
+    mtr.memcpy(*b, FIL_PAGE_PREV, srv_page_size - FIL_PAGE_PREV);
+  }
+  mtr.commit();
+}
+
 void mtr_t::init(buf_block_t *b)
 {
   const page_id_t id{b->page.id()};
@@ -4599,6 +4599,190 @@ row_merge_is_index_usable(
 		   || trx->read_view.changes_visible(index->trx_id)));
 }
 
+/** Merge sort of one index file by row_merge_sort_indexes() */
+struct row_merge_sort_job_t
+{
+	/** index being sorted, for the comparisons */
+	row_merge_dup_t	dup;
+	/** index entries; NULL if the index is sorted by the caller */
+	merge_file_t*	file;
+	/** outcome of row_merge_sort() */
+	dberr_t		error;
+};
+
+/** Work shared by the row_merge_sort_task() of row_merge_sort_indexes() */
+struct row_merge_sort_ctx_t
+{
+	/** transaction, for checking interruption */
+	trx_t*			trx;
+	/** jobs, one for each merge file */
+	row_merge_sort_job_t*	jobs;
+	/** number of elements in jobs[] */
+	ulint			n_jobs;
+	/** next element of jobs[] to be claimed */
+	std::atomic<ulint>	next;
+	/** location for creating temporary files */
+	const char*		path;
+	/** tablespace identifier, for decrypting and encrypting */
+	ulint			space;
+};
+
+/** Merge-sort index files until row_merge_sort_ctx_t::jobs is exhausted.
+Every task allocates its own buffers and temporary file.
+@param arg	row_merge_sort_ctx_t */
+static void row_merge_sort_task(void* arg)
+{
+	row_merge_sort_ctx_t*	ctx = static_cast<row_merge_sort_ctx_t*>(arg);
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+	const size_t		block_size = 3 * srv_sort_buf_size;
+	ut_new_pfx_t		block_pfx;
+	ut_new_pfx_t		crypt_pfx;
+	row_merge_block_t*	crypt_block = NULL;
+	pfs_os_file_t		tmpfd = OS_FILE_CLOSED;
+	dberr_t			error = DB_SUCCESS;
+
+	row_merge_block_t*	block = alloc.allocate_large(block_size,
+							     &block_pfx);
+	crypt_pfx.m_size = 0; /* silence bogus -Wmaybe-uninitialized */
+
+	if (block == NULL) {
+		error = DB_OUT_OF_MEMORY;
+	} else if (srv_encrypt_log) {
+		crypt_block = alloc.allocate_large(block_size, &crypt_pfx);
+
+		if (crypt_block == NULL) {
+			error = DB_OUT_OF_MEMORY;
+		}
+	}
+
+	if (error == DB_SUCCESS
+	    && !row_merge_tmpfile_if_needed(&tmpfd, ctx->path)) {
+		error = DB_OUT_OF_MEMORY;
+	}
+
+	for (ulint j; (j = ctx->next++) < ctx->n_jobs; ) {
+		row_merge_sort_job_t&	job = ctx->jobs[j];
+
+		if (!job.file) {
+			continue;
+		}
+
+		/* The progress reporting and the performance schema
+		stage are not thread-safe; they are only updated by
+		the row_merge_sort() in row_merge_build_indexes(). */
+		job.error = error == DB_SUCCESS
+			? row_merge_sort(ctx->trx, &job.dup, job.file,
+					 block, &tmpfd, false, 0, 0,
+					 crypt_block, ctx->space)
+			: error;
+	}
+
+	row_merge_file_destroy_low(tmpfd);
+
+	if (block) {
+		alloc.deallocate_large(block, &block_pfx);
+	}
+
+	if (crypt_block) {
+		alloc.deallocate_large(crypt_block, &crypt_pfx);
+	}
+}
+
+/** Merge-sort the files of the secondary indexes concurrently,
+using up to innodb_ddl_threads threads.
+Unique indexes are left to the caller, because the reporting of
+duplicates writes the TABLE::record[0] of the shared MySQL table.
+@param[in]	trx		transaction
+@param[in]	indexes		indexes being created
+@param[in]	n_indexes	size of indexes[]
+@param[in,out]	merge_files	files of the non-spatial indexes
+@param[in]	n_merge_files	size of merge_files[]
+@param[in]	table		MySQL table
+@param[in]	col_map		mapping of old column numbers to new ones
+@param[in]	space		tablespace identifier
+@return jobs, one for each merge file, to be freed by ut_free()
+@retval NULL if there is nothing to sort in parallel */
+static
+row_merge_sort_job_t*
+row_merge_sort_indexes(
+	trx_t*			trx,
+	dict_index_t**		indexes,
+	ulint			n_indexes,
+	merge_file_t*		merge_files,
+	ulint			n_merge_files,
+	struct TABLE*		table,
+	const ulint*		col_map,
+	ulint			space)
+{
+	row_merge_sort_job_t*	jobs = static_cast<row_merge_sort_job_t*>(
+		ut_malloc_nokey(n_merge_files * sizeof *jobs));
+
+	if (jobs == NULL) {
+		return(NULL);
+	}
+
+	ulint	n_sort = 0;
+
+	for (ulint k = 0, i = 0; i < n_indexes; i++) {
+		if (dict_index_is_spatial(indexes[i])) {
+			continue;
+		}
+
+		row_merge_sort_job_t&	job = jobs[k];
+		merge_file_t*		file = &merge_files[k++];
+
+		job.dup = {indexes[i], table, col_map, 0};
+		job.error = DB_SUCCESS;
+
+		if ((indexes[i]->type & DICT_FTS)
+		    || dict_index_is_unique(indexes[i])
+		    || file->fd == OS_FILE_CLOSED || file->offset <= 1) {
+			job.file = NULL;
+		} else {
+			job.file = file;
+			n_sort++;
+		}
+	}
+
+	if (n_sort < 2) {
+		ut_free(jobs);
+		return(NULL);
+	}
+
+	row_merge_sort_ctx_t	ctx;
+	ctx.trx = trx;
+	ctx.jobs = jobs;
+	ctx.n_jobs = n_merge_files;
+	ctx.next = 0;
+	ctx.path = thd_innodb_tmpdir(trx->mysql_thd);
+	ctx.space = space;
+
+	const ulint	n_tasks = std::min<ulint>(srv_ddl_threads, n_sort) - 1;
+	tpool::waitable_task**	tasks = static_cast<tpool::waitable_task**>(
+		ut_malloc_nokey(n_tasks * sizeof *tasks));
+
+	if (tasks == NULL) {
+		ut_free(jobs);
+		return(NULL);
+	}
+
+	for (ulint t = 0; t < n_tasks; t++) {
+		tasks[t] = new tpool::waitable_task(row_merge_sort_task, &ctx);
+		srv_thread_pool->submit_task(tasks[t]);
+	}
+
+	/* The calling thread is one of the sorters. */
+	row_merge_sort_task(&ctx);
+
+	for (ulint t = 0; t < n_tasks; t++) {
+		tasks[t]->wait();
+		delete tasks[t];
+	}
+
+	ut_free(tasks);
+	return(jobs);
+}
+
 /** Build indexes on a table by reading a clustered index, creating a temporary
 file containing index entries, merge sorting these index entries and inserting
 sorted index entries to indexes.
@@ -4664,6 +4848,7 @@ row_merge_build_indexes(
 	fts_psort_t*		psort_info = NULL;
 	fts_psort_t*		merge_info = NULL;
 	bool			fts_psort_initiated = false;
+	row_merge_sort_job_t*	sort_jobs = NULL;
 
 	double total_static_cost = 0;
 	double total_dynamic_cost = 0;
@@ -4824,6 +5009,12 @@ row_merge_build_indexes(
 	/* Now we have files containing index entries ready for
 	sorting and inserting. */
 
+	if (srv_ddl_threads > 1) {
+		sort_jobs = row_merge_sort_indexes(
+			trx, indexes, n_indexes, merge_files, n_merge_files,
+			table, col_map, new_table->space_id);
+	}
+
 	for (ulint k = 0, i = 0; i < n_indexes; i++) {
 		dict_index_t*	sort_idx = indexes[i];
 
@@ -4882,12 +5073,17 @@ row_merge_build_indexes(
 						      pct_cost);
 			}
 
-			error = row_merge_sort(
+			if (sort_jobs && sort_jobs[k].file) {
+				/* Sorted by row_merge_sort_indexes() */
+				error = sort_jobs[k].error;
+			} else {
+				error = row_merge_sort(
 					trx, &dup, &merge_files[k],
 					block, &tmpfd, true,
 					pct_progress, pct_cost,
 					crypt_block, new_table->space_id,
 					stage);
+			}
 
 			pct_progress += pct_cost;
 
@@ -5009,6 +5205,7 @@ row_merge_build_indexes(
 	}
 
 	ut_free(merge_files);
+	ut_free(sort_jobs);
 
 	alloc.deallocate_large(block, &block_pfx);
 
@@ -5186,27 +5383,33 @@ bool row_merge_bulk_t::create_tmp_file(ulint index_no)
 }
 
 dberr_t row_merge_bulk_t::write_to_tmp_file(ulint index_no)
+{
+  alloc_block();
+  return write_to_tmp_file(index_no, m_block, m_crypt_block);
+}
+
+dberr_t row_merge_bulk_t::write_to_tmp_file(ulint index_no,
+                                            row_merge_block_t *block,
+                                            row_merge_block_t *crypt_block)
 {
   if (!create_tmp_file(index_no))
     return DB_OUT_OF_MEMORY;
   merge_file_t *file= &m_merge_files[index_no];
   row_merge_buf_t *buf= &m_merge_buf[index_no];
 
-  alloc_block();
-
   if (dberr_t err= row_merge_buf_write(buf,
 #ifndef DBUG_OFF
                                        file,
 #endif
-                                       m_block,
+                                       block,
                                        index_no == 0 ? &m_blob_file : nullptr))
     return err;
 
   if (!row_merge_write(file->fd, file->offset++,
-                       m_block, m_crypt_block,
+                       block, crypt_block,
                        buf->index->table->space->id))
     return DB_TEMP_FILE_WRITE_FAIL;
-  MEM_UNDEFINED(&m_block[0], srv_sort_buf_size);
+  MEM_UNDEFINED(&block[0], srv_sort_buf_size);
   return DB_SUCCESS;
 }
 
@@ -5282,6 +5485,18 @@ dberr_t row_merge_bulk_t::bulk_insert_buffered(const dtuple_t &row,
 }
 
 dberr_t row_merge_bulk_t::write_to_index(ulint index_no, trx_t *trx)
+{
+  dberr_t err= write_to_index(index_no, trx, m_block, m_crypt_block,
+                              &m_tmpfd);
+  if (err != DB_SUCCESS)
+    trx->error_info= m_merge_buf[index_no].index;
+  return err;
+}
+
+dberr_t row_merge_bulk_t::write_to_index(ulint index_no, trx_t *trx,
+                                         row_merge_block_t *block,
+                                         row_merge_block_t *crypt_block,
+                                         pfs_os_file_t *tmpfd)
 {
   dberr_t err= DB_SUCCESS;
   row_merge_buf_t buf= m_merge_buf[index_no];
@@ -5307,7 +5522,7 @@ dberr_t row_merge_bulk_t::write_to_index(ulint index_no, trx_t *trx)
     if (file && file->fd != OS_FILE_CLOSED)
     {
       file->n_rec+= buf.n_tuples;
-      err= write_to_tmp_file(index_no);
+      err= write_to_tmp_file(index_no, block, crypt_block);
       if (err!= DB_SUCCESS)
         goto func_exit;
     }
@@ -5322,40 +5537,153 @@ dberr_t row_merge_bulk_t::write_to_index(ulint index_no, trx_t *trx)
     }
   }
 
+  /* The progress reporting is not thread-safe; only update it
+  if this is the only thread that is loading indexes. */
   err= row_merge_sort(trx, &dup, file,
-                      m_block, &m_tmpfd, true, 0, 0,
-                      m_crypt_block, table->space_id, nullptr);
+                      block, tmpfd, block == m_block, 0, 0,
+                      crypt_block, table->space_id, nullptr);
   if (err != DB_SUCCESS)
     goto func_exit;
 
   err= row_merge_insert_index_tuples(
-        index, table, file->fd, m_block, nullptr,
-        &btr_bulk, 0, 0, 0, m_crypt_block, table->space_id,
+        index, table, file->fd, block, nullptr,
+        &btr_bulk, 0, 0, 0, crypt_block, table->space_id,
         nullptr, &m_blob_file);
 
 func_exit:
-  if (err != DB_SUCCESS)
-    trx->error_info= index;
   err= btr_bulk.finish(err);
   return err;
 }
 
+/** Work shared by the row_merge_bulk_t::write_task() of
+row_merge_bulk_t::write_to_table() */
+struct row_merge_bulk_ctx_t
+{
+  /** the buffered indexes */
+  row_merge_bulk_t *bulk;
+  /** bulk transaction */
+  trx_t *trx;
+  /** outcome of write_to_index(), for each index */
+  dberr_t *errors;
+  /** number of elements in errors[] */
+  ulint n_index;
+  /** next index to be claimed */
+  std::atomic<ulint> next;
+};
+
+void row_merge_bulk_t::write_task(void *arg)
+{
+  row_merge_bulk_ctx_t *ctx= static_cast<row_merge_bulk_ctx_t*>(arg);
+  row_merge_bulk_t *bulk= ctx->bulk;
+  ut_allocator<row_merge_block_t> alloc(mem_key_row_merge_sort);
+  const size_t block_size= 3 * srv_sort_buf_size;
+  ut_new_pfx_t block_pfx;
+  ut_new_pfx_t crypt_pfx;
+  row_merge_block_t *crypt_block= nullptr;
+  pfs_os_file_t tmpfd= OS_FILE_CLOSED;
+  dberr_t err= DB_SUCCESS;
+
+  row_merge_block_t *block= alloc.allocate_large_dontdump(block_size,
+                                                          &block_pfx);
+  crypt_pfx.m_size= 0; /* silence bogus -Wmaybe-uninitialized */
+
+  if (!block)
+    err= DB_OUT_OF_MEMORY;
+  else if (srv_encrypt_log)
+  {
+    crypt_block= alloc.allocate_large(block_size, &crypt_pfx);
+    if (!crypt_block)
+      err= DB_OUT_OF_MEMORY;
+  }
+
+  for (ulint i; (i= ctx->next++) < ctx->n_index; )
+  {
+    if (err == DB_SUCCESS && bulk->m_merge_files &&
+        bulk->m_merge_files[i].fd != OS_FILE_CLOSED &&
+        !row_merge_tmpfile_if_needed(&tmpfd, nullptr))
+      err= DB_OUT_OF_MEMORY;
+    ctx->errors[i]= err == DB_SUCCESS
+      ? bulk->write_to_index(i, ctx->trx, block, crypt_block, &tmpfd)
+      : err;
+  }
+
+  row_merge_file_destroy_low(tmpfd);
+
+  if (block)
+    alloc.deallocate_large_dodump(block, &block_pfx);
+
+  if (crypt_block)
+    alloc.deallocate_large(crypt_block, &crypt_pfx);
+}
+
 dberr_t row_merge_bulk_t::write_to_table(dict_table_t *table, trx_t *trx)
 {
-  ulint i= 0;
+  ulint n_index= 0;
   for (dict_index_t *index= UT_LIST_GET_FIRST(table->indexes);
        index; index= UT_LIST_GET_NEXT(indexes, index))
+    if (index->is_btree())
+      n_index++;
+
+  const ulint n_tasks= std::min<ulint>(srv_ddl_threads, n_index) - 1;
+
+  if (!n_tasks)
   {
-    if (!index->is_btree())
-      continue;
+    for (ulint i= 0; i < n_index; i++)
+      if (dberr_t err= write_to_index(i, trx))
+        return err;
+    return DB_SUCCESS;
+  }
 
-    dberr_t err= write_to_index(i, trx);
-    if (err != DB_SUCCESS)
-      return err;
-    i++;
+  /* Sort and load the indexes concurrently. Each BtrBulk only
+  latches pages of its own index, and the indexes share nothing
+  but m_blob_file, which is only appended to by the clustered index. */
+  dberr_t *errors= static_cast<dberr_t*>
+    (ut_malloc_nokey(n_index * sizeof *errors));
+  tpool::waitable_task **tasks= static_cast<tpool::waitable_task**>
+    (ut_malloc_nokey(n_tasks * sizeof *tasks));
+  if (!errors || !tasks)
+  {
+    ut_free(errors);
+    ut_free(tasks);
+    return DB_OUT_OF_MEMORY;
   }
 
-  return DB_SUCCESS;
+  row_merge_bulk_ctx_t ctx;
+  ctx.bulk= this;
+  ctx.trx= trx;
+  ctx.errors= errors;
+  ctx.n_index= n_index;
+  ctx.next= 0;
+
+  for (ulint t= 0; t < n_tasks; t++)
+  {
+    tasks[t]= new tpool::waitable_task(write_task, &ctx);
+    srv_thread_pool->submit_task(tasks[t]);
+  }
+
+  /* The calling thread is one of the loaders. */
+  write_task(&ctx);
+
+  for (ulint t= 0; t < n_tasks; t++)
+  {
+    tasks[t]->wait();
+    delete tasks[t];
+  }
+
+  dberr_t err= DB_SUCCESS;
+  for (ulint i= 0; i < n_index; i++)
+  {
+    if (errors[i] != DB_SUCCESS)
+    {
+      err= errors[i];
+      trx->error_info= m_merge_buf[i].index;
+      break;
+    }
+  }
+
+  ut_free(tasks);
+  ut_free(errors);
+  return err;
 }
 
 dberr_t trx_mod_table_time_t::write_bulk(dict_table_t *table, trx_t *trx)
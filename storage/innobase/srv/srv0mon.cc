@@ -441,6 +441,11 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_SET_MEMBER, MONITOR_FLUSH_BACKGROUND_TOTAL_PAGE,
 	 MONITOR_FLUSH_BACKGROUND_PAGES},
 
+	{"buffer_flush_helper_pages", "buffer",
+	 "Pages written by page cleaner helper threads",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_FLUSH_HELPER_PAGES},
+
 	/* Cumulative counter for LRU batch scan */
 	{"buffer_LRU_batch_scanned", "buffer",
 	 "Total pages scanned as part of LRU batch",
@@ -693,6 +698,11 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_PURGE_N_PAGE_HANDLED},
 
+	{"purge_threads_active", "purge",
+	 "Number of purge tasks that were used in the latest purge batch",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_PURGE_N_THREADS},
+
 	{"purge_dml_delay_usec", "purge",
 	 "Microseconds DML to be delayed due to purge lagging",
 	 static_cast<monitor_type_t>(
@@ -130,6 +130,9 @@ bool high_level_read_only;
 
 /** Sort buffer size in index creation */
 ulong	srv_sort_buf_size;
+/** Number of threads for merge-sorting secondary indexes in
+row_merge_build_indexes() */
+ulong	srv_ddl_threads;
 /** Maximum modification log file size for online index creation */
 unsigned long long	srv_online_max_size;
 
@@ -207,6 +210,7 @@ ulong	srv_checksum_algorithm;
 
 /** innodb_read_io_threads */
 uint	srv_n_read_io_threads;
+uint	srv_flush_helper_threads;
 /** innodb_write_io_threads */
 uint	srv_n_write_io_threads;
 
@@ -216,6 +220,9 @@ my_bool	srv_random_read_ahead;
 in the buffer cache and accessed sequentially for InnoDB to trigger a
 readahead request. */
 ulong	srv_read_ahead_threshold;
+/** innodb_read_ahead_leaf_pages; the maximum number of leaf pages to read
+ahead of a forward index scan, or 0 to disable */
+ulong	srv_read_ahead_leaf_pages;
 
 /** copy of innodb_open_files; @see innodb_init_params() */
 ulint	srv_max_n_open_files;
@@ -308,6 +315,7 @@ based on number of configured pages */
 my_bool	srv_stats_sample_traditional;
 
 my_bool	srv_use_doublewrite_buf;
+my_bool	srv_log_page_images;
 
 /** innodb_sync_spin_loops */
 ulong	srv_n_spin_wait_rounds;
@@ -474,6 +482,9 @@ struct purge_coordinator_state
 
   static constexpr ulint adaptive_purge_threshold= 20;
   static constexpr ulint safety_net= 20;
+  /** History list length per active purge task above which
+  an idle server is considered to have a purge backlog */
+  static constexpr size_t backlog_per_thread= 1000;
   ulint series[innodb_purge_threads_MAX + 1];
 
   inline void compute_series();
@@ -1461,8 +1472,19 @@ inline void purge_coordinator_state::do_purge()
     else if (n_threads > n_use_threads &&
              srv_max_purge_lag && m_history_length > srv_max_purge_lag)
       goto more_threads;
-    else if (n_use_threads > 1 && old_activity_count == srv_sys.activity_count)
-      goto fewer_threads;
+    else if (old_activity_count == srv_sys.activity_count)
+    {
+      /* The server is idle. */
+      if (history_size > n_use_threads * backlog_per_thread)
+      {
+        /* There is a backlog, such as after a large DELETE.
+        Use all innodb_purge_threads to catch up. */
+        if (n_threads > n_use_threads)
+          goto more_threads;
+      }
+      else if (n_use_threads > 1)
+        goto fewer_threads;
+    }
 
     ut_ad(n_use_threads);
     ut_ad(n_use_threads <= n_threads);
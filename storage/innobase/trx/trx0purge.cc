@@ -1150,19 +1150,22 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 
 	ut_ad(purge_sys.head <= purge_sys.tail);
 
-	i = 0;
+	purge_node_t*	nodes[innodb_purge_threads_MAX];
+	ut_ad(n_purge_threads <= innodb_purge_threads_MAX);
+
+	for (i = 0; i < n_purge_threads; i++) {
+		ut_a(thr != NULL);
+		nodes[i] = static_cast<purge_node_t*>(thr->child);
+		ut_a(que_node_get_type(nodes[i]) == QUE_NODE_PURGE);
+		thr = UT_LIST_GET_NEXT(thrs, thr);
+	}
 
 	std::unordered_map<table_id_t, purge_node_t*> table_id_map;
 	mem_heap_empty(purge_sys.heap);
 
 	while (UNIV_LIKELY(srv_undo_sources) || !srv_fast_shutdown) {
-		purge_node_t*		node;
 		trx_purge_rec_t		purge_rec;
 
-		/* Get the purge node. */
-		node = (purge_node_t*) thr->child;
-		ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
-
 		/* Track the max {trx_id, undo_no} for truncating the
 		UNDO logs once we have purged the records. */
 
@@ -1187,21 +1190,20 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 
 		purge_node_t *& table_node = table_id_map[table_id];
 
-		if (table_node) {
-			node = table_node;
-		} else {
-			thr = UT_LIST_GET_NEXT(thrs, thr);
-
-			if (!(++i % n_purge_threads)) {
-				thr = UT_LIST_GET_FIRST(
-					purge_sys.query->thrs);
+		if (!table_node) {
+			/* All records of a table are processed by the
+			same purge node. Assign a table that was not seen
+			in this batch yet to the least loaded node. */
+			table_node = nodes[0];
+			for (i = 1; i < n_purge_threads; i++) {
+				if (nodes[i]->undo_recs.size()
+				    < table_node->undo_recs.size()) {
+					table_node = nodes[i];
+				}
 			}
-
-			ut_a(thr != NULL);
-			table_node = node;
 		}
 
-		node->undo_recs.push(purge_rec);
+		table_node->undo_recs.push(purge_rec);
 
 		if (n_pages_handled >= srv_purge_batch_size) {
 			break;
@@ -1313,6 +1315,7 @@ TRANSACTIONAL_TARGET ulint trx_purge(ulint n_tasks, ulint history_size)
 
 	MONITOR_INC_VALUE(MONITOR_PURGE_INVOKED, 1);
 	MONITOR_INC_VALUE(MONITOR_PURGE_N_PAGE_HANDLED, n_pages_handled);
+	MONITOR_SET(MONITOR_PURGE_N_THREADS, n_tasks);
 
 	return(n_pages_handled);
 }
@@ -0,0 +1,105 @@
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA */
+
+/*
+  Compares the speed of the sort algorithms filesort uses for fixed
+  length, memcmp() comparable sort keys. This is not run by ctest,
+  build it with "make radixsort-bench".
+*/
+#include <my_global.h>
+#include <my_sys.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Sort key lengths, e.g. 8 for BIGINT, 15 for nullable BIGINT + 6 byte rowid */
+static const size_t key_lengths[]= { 4, 8, 15, 20, 32 };
+static const uint n_keys[]= { 1000, 50000, 1000000 };
+
+enum sort_algorithm { SORT_QSORT, SORT_RADIX_LSD, SORT_RADIX_MSD };
+static const char *algorithm_names[]= { "my_qsort2", "radixsort", "msd" };
+
+
+/*
+  Fill the keys with big endian numbers having a random number of low
+  order bytes set, like normalized integer sort keys with a varying
+  number of significant digits, and a few duplicates.
+*/
+
+static void fill_keys(uchar *data, uint n, size_t length)
+{
+  for (uint i= 0; i < n; i++)
+  {
+    uchar *key= data + i * length;
+    size_t significant= 1 + (size_t) (rand() % length);
+    memset(key, 0, length - significant);
+    for (size_t j= length - significant; j < length; j++)
+      key[j]= (uchar) rand();
+    if (i && rand() % 16 == 0)
+      memcpy(key, key - length, length);
+  }
+}
+
+
+static ulonglong run_sort(sort_algorithm algorithm, uchar **keys, uint n,
+                          size_t length, uchar **buffer)
+{
+  ulonglong start= my_interval_timer();
+  switch (algorithm) {
+  case SORT_QSORT:
+    my_qsort2(keys, n, sizeof(uchar*), get_ptr_compare(length), &length);
+    break;
+  case SORT_RADIX_LSD:
+    radixsort_for_str_ptr(keys, n, length, buffer);
+    break;
+  case SORT_RADIX_MSD:
+    radixsort_msd_for_str_ptr(keys, n, length, buffer);
+    break;
+  }
+  return my_interval_timer() - start;
+}
+
+
+int main(int argc __attribute__((unused)), char **argv)
+{
+  MY_INIT(argv[0]);
+
+  srand(1);
+  for (size_t length : key_lengths)
+  {
+    for (uint n : n_keys)
+    {
+      uchar *data= (uchar*) my_malloc(PSI_NOT_INSTRUMENTED, n * length,
+                                      MYF(MY_FAE));
+      uchar **keys= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED,
+                                        n * sizeof(uchar*), MYF(MY_FAE));
+      uchar **buffer= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED,
+                                          n * sizeof(uchar*), MYF(MY_FAE));
+      fill_keys(data, n, length);
+      for (uint a= SORT_QSORT; a <= SORT_RADIX_MSD; a++)
+      {
+        for (uint i= 0; i < n; i++)
+          keys[i]= data + i * length;
+        ulonglong ns= run_sort((sort_algorithm) a, keys, n, length, buffer);
+        printf("%-10s %7u keys of %2u bytes: %8llu us\n",
+               algorithm_names[a], n, (uint) length, ns / 1000);
+      }
+      my_free(buffer);
+      my_free(keys);
+      my_free(data);
+    }
+  }
+
+  my_end(0);
+  return 0;
+}
@@ -0,0 +1,152 @@
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA */
+
+/*
+  Checks the radixsorts filesort may use for fixed length, memcmp()
+  comparable sort keys (see Filesort_buffer::sort_buffer()) against
+  my_qsort2(). For timings, see radixsort-bench.cc.
+*/
+#include <my_global.h>
+#include <my_sys.h>
+#include <string.h>
+
+#include <tap.h>
+
+enum key_fill { FILL_RANDOM, FILL_EQUAL, FILL_LAST_BYTE };
+
+struct sort_case
+{
+  uint n;
+  size_t length;
+  key_fill fill;
+};
+
+static const sort_case cases[]=
+{
+  { 0, 8, FILL_RANDOM },
+  { 1, 8, FILL_RANDOM },
+  { 2, 1, FILL_RANDOM },
+  /* Just above MSD_RADIX_INSERTION_SORT_LIMIT */
+  { 33, 4, FILL_RANDOM },
+  { 3000, 1, FILL_RANDOM },
+  { 3000, 4, FILL_RANDOM },
+  { 3000, 15, FILL_RANDOM },
+  /* MSD_RADIX_MAX_KEY_LENGTH */
+  { 3000, 32, FILL_RANDOM },
+  { 3000, 8, FILL_EQUAL },
+  { 3000, 32, FILL_LAST_BYTE },
+};
+
+
+/*
+  FILL_RANDOM: big endian numbers having a random number of low order
+  bytes set, like normalized integer sort keys, and a few duplicates.
+  FILL_EQUAL: all keys are equal.
+  FILL_LAST_BYTE: the keys only differ in their last byte.
+*/
+
+static void fill_keys(uchar *data, uint n, size_t length, key_fill fill)
+{
+  for (uint i= 0; i < n; i++)
+  {
+    uchar *key= data + i * length;
+    switch (fill) {
+    case FILL_RANDOM:
+    {
+      size_t significant= 1 + (size_t) (rand() % length);
+      memset(key, 0, length - significant);
+      for (size_t j= length - significant; j < length; j++)
+        key[j]= (uchar) rand();
+      if (i && rand() % 16 == 0)
+        memcpy(key, key - length, length);
+      break;
+    }
+    case FILL_EQUAL:
+      memset(key, 0xa5, length);
+      break;
+    case FILL_LAST_BYTE:
+      memset(key, 0x5a, length - 1);
+      key[length - 1]= (uchar) rand();
+      break;
+    }
+  }
+}
+
+
+static bool is_sorted(uchar **keys, uint n, size_t length)
+{
+  for (uint i= 1; i < n; i++)
+    if (memcmp(keys[i - 1], keys[i], length) > 0)
+      return false;
+  return true;
+}
+
+
+static bool same_keys(uchar **keys, uchar **expected, uint n, size_t length)
+{
+  for (uint i= 0; i < n; i++)
+    if (memcmp(keys[i], expected[i], length))
+      return false;
+  return true;
+}
+
+
+int main(int argc __attribute__((unused)), char **argv)
+{
+  MY_INIT(argv[0]);
+  plan(array_elements(cases) * 3);
+
+  srand(1);
+  for (const sort_case &c : cases)
+  {
+    size_t n= MY_MAX(c.n, 1);
+    uchar *data= (uchar*) my_malloc(PSI_NOT_INSTRUMENTED, n * c.length,
+                                    MYF(MY_FAE));
+    uchar **expected= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED,
+                                          n * sizeof(uchar*), MYF(MY_FAE));
+    uchar **keys= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED,
+                                      n * sizeof(uchar*), MYF(MY_FAE));
+    uchar **buffer= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED,
+                                        n * sizeof(uchar*), MYF(MY_FAE));
+    size_t length= c.length;
+    fill_keys(data, c.n, length, c.fill);
+
+    for (uint i= 0; i < c.n; i++)
+      expected[i]= data + i * length;
+    my_qsort2(expected, c.n, sizeof(uchar*), get_ptr_compare(length),
+              &length);
+    ok(is_sorted(expected, c.n, length), "my_qsort2: %u keys of %u bytes",
+       c.n, (uint) length);
+
+    for (uint i= 0; i < c.n; i++)
+      keys[i]= data + i * length;
+    radixsort_for_str_ptr(keys, c.n, length, buffer);
+    ok(same_keys(keys, expected, c.n, length),
+       "radixsort: %u keys of %u bytes", c.n, (uint) length);
+
+    for (uint i= 0; i < c.n; i++)
+      keys[i]= data + i * length;
+    radixsort_msd_for_str_ptr(keys, c.n, length, buffer);
+    ok(same_keys(keys, expected, c.n, length),
+       "msd: %u keys of %u bytes", c.n, (uint) length);
+
+    my_free(buffer);
+    my_free(keys);
+    my_free(expected);
+    my_free(data);
+  }
+
+  my_end(0);
+  return exit_status();
+}